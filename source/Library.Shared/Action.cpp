@@ -36,7 +36,7 @@ namespace Library
 	{
 		return Vector<Signature>
 		{
-			{ActionName, Datum::DatumType::STRING, 1, offsetof(Action, mActionName)}
+			PRESCRIBED_ATTRIBUTE(Action, ActionName, mActionName)
 		};
 	}
 
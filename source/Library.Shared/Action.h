@@ -17,6 +17,9 @@ namespace Library
 
 		static const std::string ActionName;
 
+		static constexpr size_t NameIndex = Attributed::PrescribedSlotCount;
+		static constexpr size_t PrescribedSlotCount = NameIndex + 1;
+
 		/// <summary>Defaulted copy constructor</summary>
 		/// <param name="rhs">Const reference to Action that is to be copied.</param>
 		Action(const Action& rhs) = default;
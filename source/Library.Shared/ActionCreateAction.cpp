@@ -4,6 +4,7 @@
 #include "Entity.h"
 #include "Sector.h"
 #include "World.h"
+#include "PrototypeRegistry.h"
 
 namespace Library
 {
@@ -43,7 +44,23 @@ namespace Library
 		assert(worldState.World != nullptr); assert(worldState.Entity != nullptr); 
 #endif
 
-		Action* action = Factory<Action>::Create(mClassName);
+		//A registered prototype takes precedence over a factory of the same name
+		Action* action;
+		const Scope* prototype = PrototypeRegistry::Find(mClassName);
+		if (prototype != nullptr)
+		{
+			gsl::owner<Scope*> clone = prototype->CloneShared();
+			action = clone->As<Action>();
+			if (action == nullptr)
+			{
+				delete clone;
+				throw std::runtime_error("The prototype registered under the class name is not an Action!");
+			}
+		}
+		else
+		{
+			action = Factory<Action>::Create(mClassName);
+		}
 		action->SetName(mInstanceName);
 		if (GetParent()->Is(ActionList::TypeIdClass()) 
 			|| GetParent()->Is(Entity::TypeIdClass()) 
@@ -57,8 +74,8 @@ namespace Library
 	Vector<Signature> ActionCreateAction::Signatures()
 	{
 		Vector<Signature> signatures = Action::Signatures();
-		signatures.PushBack({ PrototypeNameKey, Datum::DatumType::STRING, 1, offsetof(ActionCreateAction, mClassName) });
-		signatures.PushBack({ ActionNameKey, Datum::DatumType::STRING, 1, offsetof(ActionCreateAction, mInstanceName) });
+		signatures.PushBack(PRESCRIBED_ATTRIBUTE(ActionCreateAction, PrototypeNameKey, mClassName));
+		signatures.PushBack(PRESCRIBED_ATTRIBUTE(ActionCreateAction, ActionNameKey, mInstanceName));
 		return signatures;
 	}
 }
\ No newline at end of file
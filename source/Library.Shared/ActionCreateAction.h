@@ -13,6 +13,10 @@ namespace Library
 		static const std::string PrototypeNameKey;
 		static const std::string ActionNameKey;
 
+		static constexpr size_t PrototypeNameIndex = Action::PrescribedSlotCount;
+		static constexpr size_t ActionNameIndex = PrototypeNameIndex + 1;
+		static constexpr size_t PrescribedSlotCount = ActionNameIndex + 1;
+
 
 		/// <summary>Default constructor</summary>
 		ActionCreateAction();
@@ -50,7 +54,7 @@ namespace Library
 		/// <returns>Const reference to instance name, stored as std::string</returns>
 		void SetInstanceName(const std::string& instanceName);
 
-		/// <summary>Update method for ActionCreateAction</summary>
+		/// <summary>Update method for ActionCreateAction, clones the prototype registered under the class name or uses the action factory when there is none</summary>
 		/// <param name="worldState">WorldState reference</param>
 		virtual void Update(WorldState& worldState) override;
 
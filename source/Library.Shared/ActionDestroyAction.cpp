@@ -47,7 +47,7 @@ namespace Library
 	Vector<Signature> ActionDestroyAction::Signatures()
 	{
 		Vector<Signature> signatures = Action::Signatures();
-		signatures.PushBack({ ActionInstanceKey, Datum::DatumType::STRING, 1, offsetof(ActionDestroyAction, mActionInstance) });
+		signatures.PushBack(PRESCRIBED_ATTRIBUTE(ActionDestroyAction, ActionInstanceKey, mActionInstance));
 		return signatures;
 	}
 
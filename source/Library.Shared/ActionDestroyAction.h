@@ -13,6 +13,9 @@ namespace Library
 		static const std::string ActionInstanceKey;
 		static const std::string ActionsKey;
 
+		static constexpr size_t ActionInstanceIndex = Action::PrescribedSlotCount;
+		static constexpr size_t PrescribedSlotCount = ActionInstanceIndex + 1;
+
 
 		/// <summary>Default constructor</summary>
 		ActionDestroyAction();
@@ -13,11 +13,10 @@ namespace Library
 
 	Vector<Signature> ActionEvent::Signatures()
 	{
-		return 
-		{
-			{ SubtypeKey, Datum::DatumType::STRING, 1, offsetof(ActionEvent, mSubtype) },
-			{ DelayKey, Datum::DatumType::INTEGER, 1, offsetof(ActionEvent, mDelay) }
-		};
+		Vector<Signature> signatures = Action::Signatures();
+		signatures.PushBack(PRESCRIBED_ATTRIBUTE(ActionEvent, SubtypeKey, mSubtype));
+		signatures.PushBack(PRESCRIBED_ATTRIBUTE(ActionEvent, DelayKey, mDelay));
+		return signatures;
 	}
 
 	ActionEvent::ActionEvent(const std::string& subtype, const std::string& name) : Action(TypeIdClass(), name), mSubtype(subtype)
@@ -41,12 +40,12 @@ namespace Library
 
 	std::size_t ActionEvent::GetDelay() const
 	{
-		return mDelay;
+		return static_cast<std::size_t>(mDelay);
 	}
 
 	void ActionEvent::SetDelay(const std::size_t delay)
 	{
-		mDelay = delay;
+		mDelay = static_cast<std::int32_t>(delay);
 	}
 
 	gsl::owner<ActionEvent*> ActionEvent::Clone() const
@@ -59,13 +58,9 @@ namespace Library
 		worldState.Action = this;
 		EventMessageAttributed message(*worldState.World, mSubtype);
 
-		auto attributes = GetAttributes();
-		for (auto& attribute : attributes)
+		for (const LookupTableEntry* attribute : GetAuxiliaryAttributes())
 		{
-			if (!IsPrescribedAttribute(attribute->first))
-			{
-				message.AppendAuxiliaryAttribute(attribute->first) = attribute->second;
-			}
+			message.AppendAuxiliaryAttribute(attribute->first) = attribute->second;
 		}
 		std::shared_ptr<Event<EventMessageAttributed>> event_ptr = std::make_shared<Event<EventMessageAttributed>>(message);
 		worldState.World->GetEventQueue().EnqueueEvent(event_ptr, worldState.GetGameTime(), Milliseconds(mDelay));
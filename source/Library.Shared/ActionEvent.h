@@ -17,6 +17,10 @@ namespace Library
 		static const std::string SubtypeKey;
 		static const std::string DelayKey;
 
+		static constexpr size_t SubtypeIndex = Action::PrescribedSlotCount;
+		static constexpr size_t DelayIndex = SubtypeIndex + 1;
+		static constexpr size_t PrescribedSlotCount = DelayIndex + 1;
+
 		/// <summary>
 		/// Gets signatures to be passed to TypeRegistry
 		/// </summary>
@@ -113,9 +117,9 @@ namespace Library
 		std::string mSubtype;
 
 		/// <summary>
-		/// Delay of event that's to be queued
+		/// Delay of event that's to be queued, stored as the INTEGER the "Delay" attribute binds to
 		/// </summary>
-		std::size_t mDelay;
+		std::int32_t mDelay;
 	};
 
 	CONCRETE_FACTORY(ActionEvent, Scope)
@@ -6,7 +6,6 @@ namespace Library
 	RTTI_DEFINITIONS(ActionList)
 
 	const std::string ActionList::ActionsKey = "Actions";
-	const std::size_t ActionList::ActionsIndex = 2;
 
 	ActionList::ActionList() : ActionList(std::string())
 	{
@@ -27,13 +26,13 @@ namespace Library
 
 	Datum& ActionList::Actions()
 	{
-		return (*this)[ActionsIndex];
+		return PrescribedAttribute(ActionsIndex);
 	}
 
 	Vector<Signature> ActionList::Signatures()
 	{
 		Vector<Signature> signatures = Action::Signatures();
-		signatures.PushBack({ ActionsKey, Datum::DatumType::TABLE, 0, 0 });
+		signatures.PushBack(MakeTableSignature(ActionsKey));
 		return signatures;
 	}
 
@@ -13,7 +13,8 @@ namespace Library
 	public:
 
 		static const std::string ActionsKey;
-		static const size_t ActionsIndex;
+		static constexpr size_t ActionsIndex = Action::PrescribedSlotCount;
+		static constexpr size_t PrescribedSlotCount = ActionsIndex + 1;
 
 		/// <summary>Default constructor </summary>
 		ActionList();
@@ -9,8 +9,6 @@ namespace Library
 	const std::string ActionListIf::ConditionKey = "Condition";
 	const std::string ActionListIf::ThenKey = "Then";
 	const std::string ActionListIf::ElseKey = "Else";
-	const std::size_t ActionListIf::ThenIndex = 3;
-	const std::size_t ActionListIf::ElseIndex = 4;
 
 
 	ActionListIf::ActionListIf() : ActionListIf(std::string())
@@ -23,7 +21,7 @@ namespace Library
 
 	void ActionListIf::Update(WorldState& worldState) 
 	{ 
-		Datum& datum = mCondition ? operator[](ThenIndex) : operator[](ElseIndex); 
+		Datum& datum = PrescribedAttribute(mCondition ? ThenIndex : ElseIndex);
 		
 		for (size_t i = 0; i < datum.Size(); ++i) 
 		{ 
@@ -38,12 +36,12 @@ namespace Library
 
 	void ActionListIf::SetCondition(const size_t condition)
 	{
-		mCondition = condition;
+		mCondition = static_cast<std::int32_t>(condition);
 	}
 
 	void ActionListIf::SetIfBlock(Action& ifAction)
 	{
-		Datum& datum = (*this)[ThenKey];
+		Datum& datum = PrescribedAttribute(ThenIndex);
 		if (datum.Size() == 0)
 		{
 			Adopt(ifAction, ThenKey);
@@ -56,7 +54,7 @@ namespace Library
 
 	void ActionListIf::SetElseBlock(Action& elseAction)
 	{
-		Datum& datum = (*this)[ElseKey];
+		Datum& datum = PrescribedAttribute(ElseIndex);
 		if (datum.Size() == 0)
 		{
 			Adopt(elseAction, ElseKey);
@@ -70,9 +68,9 @@ namespace Library
 	Vector<Signature> ActionListIf::Signatures()
 	{
 		Vector<Signature> signatures = ActionList::Signatures();
-		signatures.PushBack({ ConditionKey, Datum::DatumType::INTEGER, 1, offsetof(ActionListIf, mCondition) });
-		signatures.PushBack({ ThenKey, Datum::DatumType::TABLE, 0, 0 });
-		signatures.PushBack({ ElseKey, Datum::DatumType::TABLE, 0, 0 });
+		signatures.PushBack(PRESCRIBED_ATTRIBUTE(ActionListIf, ConditionKey, mCondition));
+		signatures.PushBack(MakeTableSignature(ThenKey));
+		signatures.PushBack(MakeTableSignature(ElseKey));
 		return signatures;
 	}
 
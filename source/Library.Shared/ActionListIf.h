@@ -10,11 +10,14 @@ namespace Library
 		static const std::string ConditionKey;
 		static const std::string ThenKey;
 		static const std::string ElseKey;
-		static const std::size_t ThenIndex;
-		static const std::size_t ElseIndex;
 
 
 	public:
+		static constexpr size_t ConditionIndex = ActionList::PrescribedSlotCount;
+		static constexpr size_t ThenIndex = ConditionIndex + 1;
+		static constexpr size_t ElseIndex = ThenIndex + 1;
+		static constexpr size_t PrescribedSlotCount = ElseIndex + 1;
+
 		/// <summary>Default constructor</summary>
 		ActionListIf();
 
@@ -70,7 +73,7 @@ namespace Library
 		virtual gsl::owner<Scope*> Clone() const override;
 
 	private:
-		size_t mCondition;
+		std::int32_t mCondition;
 	};
 
 	CONCRETE_FACTORY(ActionListIf, Scope)
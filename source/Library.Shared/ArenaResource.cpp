@@ -0,0 +1,122 @@
+#include "pch.h"
+#include "ArenaResource.h"
+#include <cstring>
+
+namespace Library
+{
+	ArenaResource::ArenaResource(size_t chunkSize, MemoryResource& upstream) : mUpstream(upstream), mChunkSize(AlignUp(chunkSize))
+	{
+		if (chunkSize == 0)
+		{
+			throw std::runtime_error("Arena chunk size must be greater than 0!");
+		}
+	}
+
+	ArenaResource::~ArenaResource()
+	{
+		Release();
+	}
+
+	void* ArenaResource::Allocate(size_t bytes)
+	{
+		bytes = AlignUp(bytes);
+
+		if (mCurrent == nullptr || mOffset + bytes > mCurrent->Size)
+		{
+			//After a Reset the following chunk may already be big enough, otherwise link a new one in after the current chunk
+			Chunk* next = (mCurrent != nullptr ? mCurrent->Next : mFirst);
+			if (next == nullptr || bytes > next->Size)
+			{
+				size_t size = (bytes > mChunkSize ? bytes : mChunkSize);
+				Chunk* chunk = static_cast<Chunk*>(mUpstream.Allocate(AlignUp(sizeof(Chunk)) + size));
+				chunk->Size = size;
+				chunk->Next = next;
+				if (mCurrent != nullptr)
+				{
+					mCurrent->Next = chunk;
+				}
+				else
+				{
+					mFirst = chunk;
+				}
+				mBytesReserved += size;
+				next = chunk;
+			}
+			mCurrent = next;
+			mOffset = 0;
+		}
+
+		void* pointer = ChunkData(mCurrent) + mOffset;
+		mOffset += bytes;
+		mBytesUsed += bytes;
+		return pointer;
+	}
+
+	void ArenaResource::Deallocate(void* pointer, size_t bytes)
+	{
+		if (pointer != nullptr && IsLastAllocation(pointer, bytes))
+		{
+			mOffset -= AlignUp(bytes);
+			mBytesUsed -= AlignUp(bytes);
+		}
+	}
+
+	void* ArenaResource::Reallocate(void* pointer, size_t oldBytes, size_t newBytes)
+	{
+		if (pointer != nullptr && IsLastAllocation(pointer, oldBytes))
+		{
+			size_t start = mOffset - AlignUp(oldBytes);
+			if (start + AlignUp(newBytes) <= mCurrent->Size)
+			{
+				mBytesUsed = mBytesUsed - AlignUp(oldBytes) + AlignUp(newBytes);
+				mOffset = start + AlignUp(newBytes);
+				return pointer;
+			}
+		}
+		return MemoryResource::Reallocate(pointer, oldBytes, newBytes);
+	}
+
+	void ArenaResource::Reset()
+	{
+		mCurrent = nullptr;
+		mOffset = 0;
+		mBytesUsed = 0;
+	}
+
+	void ArenaResource::Release()
+	{
+		while (mFirst != nullptr)
+		{
+			Chunk* next = mFirst->Next;
+			mUpstream.Deallocate(mFirst, AlignUp(sizeof(Chunk)) + mFirst->Size);
+			mFirst = next;
+		}
+		mBytesReserved = 0;
+		Reset();
+	}
+
+	size_t ArenaResource::BytesUsed() const
+	{
+		return mBytesUsed;
+	}
+
+	size_t ArenaResource::BytesReserved() const
+	{
+		return mBytesReserved;
+	}
+
+	size_t ArenaResource::AlignUp(size_t bytes)
+	{
+		return (bytes + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+	}
+
+	std::byte* ArenaResource::ChunkData(Chunk* chunk)
+	{
+		return reinterpret_cast<std::byte*>(chunk) + AlignUp(sizeof(Chunk));
+	}
+
+	bool ArenaResource::IsLastAllocation(const void* pointer, size_t bytes) const
+	{
+		return (mCurrent != nullptr && AlignUp(bytes) <= mOffset && pointer == ChunkData(mCurrent) + mOffset - AlignUp(bytes));
+	}
+}
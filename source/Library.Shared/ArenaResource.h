@@ -0,0 +1,74 @@
+#pragma once
+#include "MemoryResource.h"
+
+namespace Library
+{
+	/// <summary>
+	/// Bump allocator. Allocations are carved linearly out of large chunks and individual deallocations are ignored
+	/// (except for the most recent block, which can be rolled back or grown in place). Everything is reclaimed at once
+	/// with Reset or Release, which makes it suitable for per-frame scratch data or everything owned by one level.
+	/// Not thread safe.
+	/// </summary>
+	class ArenaResource final : public MemoryResource
+	{
+	public:
+		static const size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+		/// <summary>
+		/// Constructor, no memory is requested until the first allocation
+		/// </summary>
+		/// <param name="chunkSize">Minimum number of bytes requested from upstream at a time</param>
+		/// <param name="upstream">Resource the chunks are allocated from</param>
+		explicit ArenaResource(size_t chunkSize = DEFAULT_CHUNK_SIZE, MemoryResource& upstream = MemoryResource::Heap());
+
+		/// <summary>
+		/// Destructor, releases every chunk
+		/// </summary>
+		~ArenaResource();
+
+		void* Allocate(size_t bytes) override;
+		void Deallocate(void* pointer, size_t bytes) override;
+		void* Reallocate(void* pointer, size_t oldBytes, size_t newBytes) override;
+
+		/// <summary>
+		/// Rewinds the arena, keeping its chunks for reuse. Every block handed out so far becomes invalid.
+		/// </summary>
+		void Reset();
+
+		/// <summary>
+		/// Returns every chunk to the upstream resource. Every block handed out so far becomes invalid.
+		/// </summary>
+		void Release();
+
+		/// <summary>
+		/// Provides number of bytes handed out since the last Reset or Release, including alignment padding
+		/// </summary>
+		/// <returns>Number of bytes in use</returns>
+		size_t BytesUsed() const;
+
+		/// <summary>
+		/// Provides number of bytes held in chunks obtained from the upstream resource
+		/// </summary>
+		/// <returns>Number of bytes reserved</returns>
+		size_t BytesReserved() const;
+
+	private:
+		struct Chunk final
+		{
+			Chunk* Next;
+			size_t Size;
+		};
+
+		static size_t AlignUp(size_t bytes);
+		static std::byte* ChunkData(Chunk* chunk);
+		bool IsLastAllocation(const void* pointer, size_t bytes) const;
+
+		MemoryResource& mUpstream;
+		size_t mChunkSize;
+		Chunk* mFirst = nullptr;
+		Chunk* mCurrent = nullptr;
+		size_t mOffset = 0;
+		size_t mBytesUsed = 0;
+		size_t mBytesReserved = 0;
+	};
+}
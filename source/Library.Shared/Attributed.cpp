@@ -6,21 +6,29 @@ namespace Library
 {
 	RTTI_DEFINITIONS(Attributed);
 
-	Attributed::Attributed(RTTI::IdType typeID)
+	namespace
 	{
-		(*this)["this"] = this;
+		const InternedString ThisName("this");
+
+		//Room for a few auxiliary attributes on top of the prescribed ones before the scope has to grow
+		const size_t AuxiliaryReserve = 8;
+	}
+
+	Attributed::Attributed(RTTI::IdType typeID) : Scope(TypeRegistry::PrescribedAttributeCount(typeID) + AuxiliaryReserve)
+	{
+		(*this)[ThisName] = this;
 		Populate(typeID);
 	}
 
 	Attributed::Attributed(const Attributed& rhs) : Scope(rhs)
 	{
-		(*this)["this"] = this;
+		(*this)[ThisName] = this;
 		UpdateExternalStorage(rhs.TypeIdInstance());
 	}
 
 	Attributed::Attributed(Attributed&& rhs) : Scope(std::move(rhs))
 	{
-		(*this)["this"] = this;
+		(*this)[ThisName] = this;
 		UpdateExternalStorage(rhs.TypeIdInstance());
 	}
 
@@ -29,7 +37,7 @@ namespace Library
 		if (this != &rhs)
 		{
 			Scope::operator=(rhs);
-			(*this)["this"] = this;
+			(*this)[ThisName] = this;
 			UpdateExternalStorage(rhs.TypeIdInstance());
 		}
 		return *this;
@@ -40,40 +48,28 @@ namespace Library
 		if (this != &rhs)
 		{
 			Scope::operator=(std::move(rhs));
-			(*this)["this"] = this;
+			(*this)[ThisName] = this;
 			UpdateExternalStorage(rhs.TypeIdInstance());
 		}
 		return *this;
 	}
 
-	bool Attributed::IsAttribute(const std::string& name) const
+	bool Attributed::IsAttribute(std::string_view name) const
 	{
 		return (Find(name) != nullptr);
 	}
 
-	bool Attributed::IsPrescribedAttribute(const std::string& name) const
+	bool Attributed::IsPrescribedAttribute(std::string_view name) const
 	{
-		if ("this" == name)
-		{
-			return true;
-		}
-		const Vector<Signature> signatures = TypeRegistry::GetSignatures(TypeIdInstance());
-		for (auto& signature : signatures)
-		{
-			if (signature.name == name)
-			{
-				return true;
-			}
-		}
-		return false;
+		return TypeRegistry::IsPrescribedAttribute(TypeIdInstance(), name);
 	}
 
-	bool Attributed::IsAuxiliaryAttribute(const std::string& name) const
+	bool Attributed::IsAuxiliaryAttribute(std::string_view name) const
 	{
 		return (IsAttribute(name) && !IsPrescribedAttribute(name));
 	}
 
-	Datum& Attributed::AppendAuxiliaryAttribute(const std::string& name) 
+	Datum& Attributed::AppendAuxiliaryAttribute(std::string_view name) 
 	{
 		if (IsPrescribedAttribute(name))
 		{
@@ -82,19 +78,48 @@ namespace Library
 		return Append(name);
 	}
 
-	const Vector<std::pair<std::string, Datum>*> Attributed::GetAttributes() const
+	Scope::AttributeSpan Attributed::GetAttributes() const
+	{
+		return GetPointersList();
+	}
+
+	Scope::AttributeSpan Attributed::GetPrescribedAttributes() const
+	{
+		return GetPointersList().Subspan(0, PrescribedAttributeCount());
+	}
+
+	Scope::AttributeSpan Attributed::GetAuxiliaryAttributes() const
+	{
+		//A cleared scope holds fewer entries than the type prescribes
+		AttributeSpan attributes = GetPointersList();
+		return attributes.Subspan(std::min(PrescribedAttributeCount(), attributes.Size()));
+	}
+
+	size_t Attributed::PrescribedAttributeCount() const
+	{
+		return TypeRegistry::PrescribedAttributeCount(TypeIdInstance());
+	}
+
+	Datum& Attributed::PrescribedAttribute(size_t index)
+	{
+		return GetPointersList()[index]->second;
+	}
+
+	const Datum& Attributed::PrescribedAttribute(size_t index) const
 	{
-		const Vector<std::pair<std::string, Datum>*> attributedPointers = GetPointersList();
-		return attributedPointers;
+		return GetPointersList()[index]->second;
 	}
 
 	void Attributed::UpdateExternalStorage(RTTI::IdType typeID)
 	{
+		//The prescribed attributes keep their order through copies and moves, so signature i is still entry i + 1
 		const Vector<Signature>& signatures = TypeRegistry::GetSignatures(typeID);
+		AttributeSpan attributes = GetPointersList();
 
-		for (const auto& signature : signatures)
+		for (size_t i = 0; i < signatures.Size(); ++i)
 		{
-			Datum& datum = At(signature.name);
+			const Signature& signature = signatures[i];
+			Datum& datum = attributes[i + 1]->second;
 			datum.SetType(signature.type);
 					   
 			if (signature.type != Datum::DatumType::TABLE)
@@ -108,9 +133,11 @@ namespace Library
 	void Attributed::Populate(RTTI::IdType typeID)
 	{
 		const Vector<Signature>& signatures = TypeRegistry::GetSignatures(typeID);
-		for (const auto& signature : signatures)
+		const Vector<InternedString>& names = TypeRegistry::GetPrescribedNames(typeID);
+		for (size_t i = 0; i < signatures.Size(); ++i)
 		{
-			Datum& datum = Append(signature.name);
+			const Signature& signature = signatures[i];
+			Datum& datum = Append(names[i + 1]);
 			datum.SetType(signature.type);
 
 			if (signature.type != Datum::DatumType::TABLE)
@@ -121,9 +148,9 @@ namespace Library
 			else
 			{
 				datum.SetType(Datum::DatumType::TABLE);
-				for (size_t i = 0; i < signature.size; ++i)
+				for (size_t j = 0; j < signature.size; ++j)
 				{
-					AppendScope(signature.name);
+					AppendScope(names[i + 1].String());
 				}
 			}
 		}
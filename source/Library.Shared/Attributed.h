@@ -12,6 +12,17 @@ namespace Library
 
 	public:
 
+		/// <summary>
+		/// Slot of the "this" attribute. Every type numbers its own prescribed attributes from its parent's PrescribedSlotCount,
+		/// in the order its Signatures() lists them, so a slot index resolves to the same Datum for the type and all its subtypes.
+		/// </summary>
+		static constexpr size_t ThisIndex = 0;
+
+		/// <summary>
+		/// Number of prescribed slots declared up to and including this type
+		/// </summary>
+		static constexpr size_t PrescribedSlotCount = ThisIndex + 1;
+
 		/// <summary>
 		/// Destructor
 		/// </summary>
@@ -22,34 +33,66 @@ namespace Library
 		/// </summary>
 		/// <param name="name">Name of attribute</param>
 		/// <returns>True if it is in the scope, false if not</returns>
-		bool IsAttribute(const std::string& name) const;
+		bool IsAttribute(std::string_view name) const;
 		
 		/// <summary>
-		/// Checks whether prescribed attribute with given name is in the scope
+		/// Checks whether prescribed attribute with given name is in the scope, a single lookup in the type's cached index
 		/// </summary>
 		/// <param name="name">Name of attribute</param>
 		/// <returns>True if it is in the scope, false if not</returns>
-		bool IsPrescribedAttribute(const std::string& name) const;
+		bool IsPrescribedAttribute(std::string_view name) const;
 		
 		/// <summary>
 		/// Checks whether auxiliary attribute with given name is in the scope
 		/// </summary>
 		/// <param name="name">Name of attribute</param>
 		/// <returns>True if it is in the scope, false if not</returns>
-		bool IsAuxiliaryAttribute(const std::string& name) const;
+		bool IsAuxiliaryAttribute(std::string_view name) const;
 
 		/// <summary>
 		/// Appends an auxiliary attribute to the scope, returns it if it already exists
 		/// </summary>
 		/// <param name="name">Name of the attribute</param>
 		/// <returns>Reference to datum</returns>
-		Datum& AppendAuxiliaryAttribute(const std::string& name);
+		Datum& AppendAuxiliaryAttribute(std::string_view name);
+
+		/// <summary>
+		/// Accessor method for attributes in Scope, prescribed attributes first followed by the auxiliary ones
+		/// </summary>
+		/// <returns>Span over the pointers to string/datum pairs, valid until an attribute is appended or the scope is cleared</returns>
+		AttributeSpan GetAttributes() const;
+
+		/// <summary>
+		/// Accessor method for the prescribed attributes, "this" included
+		/// </summary>
+		/// <returns>Span over the leading PrescribedAttributeCount() attributes</returns>
+		AttributeSpan GetPrescribedAttributes() const;
+
+		/// <summary>
+		/// Accessor method for the auxiliary attributes
+		/// </summary>
+		/// <returns>Span over the attributes following the prescribed ones</returns>
+		AttributeSpan GetAuxiliaryAttributes() const;
+
+		/// <summary>
+		/// Provides number of prescribed attributes ("this" included), the auxiliary attributes start at this index of GetAttributes
+		/// </summary>
+		/// <returns>Number of prescribed attributes</returns>
+		size_t PrescribedAttributeCount() const;
+
+		/// <summary>
+		/// Accessor for a prescribed attribute by slot index, straight to the Datum without a name lookup
+		/// </summary>
+		/// <param name="index">Slot index declared by the type, e.g. Entity::ActionsIndex</param>
+		/// <returns>Reference to the datum in that slot</returns>
+		Datum& PrescribedAttribute(size_t index);
 
 		/// <summary>
-		/// Accessor method for attributes in Scope
+		/// Accessor for a prescribed attribute by slot index, straight to the Datum without a name lookup
 		/// </summary>
-		/// <returns>Const vector of pointers to string/datum pairs</returns>
-		const Vector<std::pair<std::string, Datum>*> GetAttributes() const;
+		/// <param name="index">Slot index declared by the type, e.g. Entity::ActionsIndex</param>
+		/// <returns>Const reference to the datum in that slot</returns>
+		const Datum& PrescribedAttribute(size_t index) const;
 
 		/// <summary>
 		/// Creates a clone of the object (overriden from Scope)
@@ -1,5 +1,8 @@
 #include "pch.h"
 #include "Datum.h"
+#include "Scope.h"
+#include "NumericText.h"
+#include "DatumMath.h"
 
 namespace Library
 {
@@ -21,11 +24,34 @@ namespace Library
 		sizeof(float_t),
 		sizeof(glm::vec4),
 		sizeof(glm::mat4x4),
+		sizeof(Scope*),
 		sizeof(std::string),
-		sizeof(RTTI*),
-		sizeof(Scope*)
+		sizeof(RTTI*)
 	};
 
+	//Inline storage is relocated with memcpy, so only trivially copyable element types may fit in it
+	static_assert(sizeof(std::string) > Datum::INLINE_STORAGE_SIZE, "Strings must not fit in Datum's inline storage");
+
+	namespace
+	{
+		thread_local bool sCopyOnWrite = false;
+	}
+
+	CopyOnWriteGuard::CopyOnWriteGuard() : mPrevious(sCopyOnWrite)
+	{
+		sCopyOnWrite = true;
+	}
+
+	CopyOnWriteGuard::~CopyOnWriteGuard()
+	{
+		sCopyOnWrite = mPrevious;
+	}
+
+	bool CopyOnWriteGuard::IsActive()
+	{
+		return sCopyOnWrite;
+	}
+
 	Datum::Datum()
 	{
 		//Default constructor
@@ -36,18 +62,30 @@ namespace Library
 		Clear();
 	}
 
+	Datum::Datum(MemoryResource& resource) : mResource(&resource)
+	{
+	}
+
 	Datum::Datum(const Datum& rhs)
 	{
 		operator=(rhs);
 	}
 
-	Datum::Datum(Datum&& rhs) : mData(rhs.mData), mType(rhs.mType), mSize(rhs.mSize), mCapacity(rhs.mCapacity), mIsExternal(rhs.mIsExternal)
+	Datum::Datum(Datum&& rhs) : mData(rhs.mData), mType(rhs.mType), mSize(rhs.mSize), mCapacity(rhs.mCapacity), mIsExternal(rhs.mIsExternal), mTombstones(rhs.mTombstones), mShareCount(rhs.mShareCount.load()), mHasMutableViews(rhs.mHasMutableViews), mResource(rhs.mResource), mGrowthStrategy(rhs.mGrowthStrategy)
 	{
+		if (rhs.IsInline())
+		{
+			memcpy(mInlineStorage, rhs.mInlineStorage, INLINE_STORAGE_SIZE);
+			mData.vp = mInlineStorage;
+		}
+		rhs.MarkModified();
 		rhs.mData.mInt = nullptr;
 		rhs.mType = DatumType::UNKNOWN;
 		rhs.mSize = 0;
 		rhs.mCapacity = 0;
 		rhs.mIsExternal = false;
+		rhs.mTombstones = 0;
+		rhs.mShareCount = nullptr;
 	}
 
 
@@ -63,12 +101,27 @@ namespace Library
 			mSize = rhs.mSize;
 			mCapacity = rhs.mCapacity;
 			mIsExternal = rhs.mIsExternal;
+			mTombstones = rhs.mTombstones;
+			mShareCount = rhs.mShareCount.load();
+			//References into the old buffer may still be written through, and the moved buffer's references now land here
+			mHasMutableViews = mHasMutableViews || rhs.mHasMutableViews;
+			mResource = rhs.mResource;
+			mGrowthStrategy = rhs.mGrowthStrategy;
+
+			if (rhs.IsInline())
+			{
+				memcpy(mInlineStorage, rhs.mInlineStorage, INLINE_STORAGE_SIZE);
+				mData.vp = mInlineStorage;
+			}
 
+			rhs.MarkModified();
 			rhs.mData.mInt = nullptr;
 			rhs.mType = DatumType::UNKNOWN;
 			rhs.mSize = 0;
 			rhs.mCapacity = 0;
-			mIsExternal = false;
+			rhs.mIsExternal = false;
+			rhs.mTombstones = 0;
+			rhs.mShareCount = nullptr;
 		}
 		return *this;
 	}
@@ -78,14 +131,37 @@ namespace Library
 		if (this != &rhs)
 		{
 			Clear();
+			rhs.CompactTable();
 
 			mType = rhs.mType;
 			mIsExternal = rhs.mIsExternal;
+			mGrowthStrategy = rhs.mGrowthStrategy;
 
 			if (IsExternal())
 			{
 				mData = rhs.mData;
 			}
+			else if (CopyOnWriteGuard::IsActive() && mType != DatumType::TABLE && rhs.mSize > 0 && !rhs.IsInline() && !rhs.mHasMutableViews && mResource == rhs.mResource)
+			{
+				//Share the buffer, BeginWrite copies it on the first write to either Datum
+				std::atomic<size_t>* shareCount = rhs.mShareCount.load();
+				if (shareCount == nullptr)
+				{
+					//Threads copying the same source may race to create the count, the losers free theirs and use the winner's
+					std::atomic<size_t>* created = new (mResource->Allocate(sizeof(std::atomic<size_t>)))std::atomic<size_t>(1);
+					if (rhs.mShareCount.compare_exchange_strong(shareCount, created))
+					{
+						shareCount = created;
+					}
+					else
+					{
+						mResource->Deallocate(created, sizeof(std::atomic<size_t>));
+					}
+				}
+				++(*shareCount);
+				mShareCount = shareCount;
+				mData = rhs.mData;
+			}
 			else
 			{
 				Reserve(rhs.mCapacity);
@@ -161,11 +237,16 @@ namespace Library
 			{
 				throw std::runtime_error("Datum's data type cannot be changed once assigned!");
 			}
+			if (mType != type)
+			{
+				MarkModified();
+			}
 			mType = type;
 		}
 
 		size_t Datum::Size() const
 		{
+			CompactTable();
 			return mSize;
 		}
 
@@ -174,8 +255,14 @@ namespace Library
 			return mCapacity;
 		}
 
+		size_t Datum::TombstoneCount() const
+		{
+			return mTombstones;
+		}
+
 		void Datum::Resize(size_t newSize)
 		{
+			CompactTable();
 			if (mIsExternal)
 			{
 				throw std::runtime_error("Cannot set size for datum with external storage!");
@@ -185,6 +272,8 @@ namespace Library
 				throw std::runtime_error("Cannot set size for datum with unknown type!");
 			}
 
+			BeginWrite();
+			bool shrinking = newSize < mSize;
 			if (mCapacity < newSize)
 			{
 				Reserve(newSize);
@@ -258,49 +347,102 @@ namespace Library
 				case DatumType::TABLE:
 					mSize--;
 					new(mData.mScope + mSize)Scope* (nullptr);
+					break;
 				default:
 					throw std::runtime_error("Cannot set size for datum with unknown type!");
 				}
 			}
+			if (!shrinking)
+			{
+				return;
+			}
+			if (mCapacity > mSize && mData.vp != nullptr && !IsInline())
+			{
+				//Capacity follows the size, so shrink the block to what Clear will later hand back to the resource
+				if (mType == DatumType::STRING)
+				{
+					ReallocateStrings(mSize);
+				}
+				else
+				{
+					size_t typeSize = DatumTypeSizes[static_cast<std::size_t>(mType)];
+					mData.vp = mResource->Reallocate(mData.vp, mCapacity * typeSize, mSize * typeSize);
+				}
+			}
 			mCapacity = mSize;
 		}
 
+		void Datum::ReallocateStrings(size_t newCapacity)
+		{
+			std::string* strings = reinterpret_cast<std::string*>(mResource->Allocate(newCapacity * sizeof(std::string)));
+			for (size_t i = 0; i < mSize; ++i)
+			{
+				new (strings + i)std::string(std::move(mData.mString[i]));
+				mData.mString[i].std::string::~string();
+			}
+			mResource->Deallocate(mData.mString, mCapacity * sizeof(std::string));
+			mData.mString = strings;
+		}
+
 		void Datum::Reserve(size_t newCapacity)
 		{
 			if (mIsExternal)
 			{
 				throw std::runtime_error("Cannot reserve memory for datum with external storage!");
 			}
+			if (mType == DatumType::UNKNOWN)
+			{
+				//Nothing to size the elements by, claiming capacity here would let the first PushBack write through null
+				return;
+			}
+			BeginWrite();
 
 			if (mCapacity < newCapacity)
 			{
+				size_t typeSize = DatumTypeSizes[static_cast<std::size_t>(mType)];
+				if (typeSize > 0 && newCapacity * typeSize <= INLINE_STORAGE_SIZE && (mCapacity == 0 || IsInline()))
+				{
+					mData.vp = mInlineStorage;
+					mCapacity = newCapacity;
+					return;
+				}
+				if (IsInline())
+				{
+					//Growing out of the inline storage, elements are trivially copyable so they can be moved with memcpy
+					void* heap = mResource->Allocate(newCapacity * typeSize);
+					memcpy(heap, mInlineStorage, mSize * typeSize);
+					mData.vp = heap;
+					mCapacity = newCapacity;
+					return;
+				}
+
 				switch (mType)
 				{
 				case DatumType::INTEGER:
-					mData.mInt = reinterpret_cast<int32_t*>(realloc(mData.mInt, newCapacity * sizeof(int32_t)));
+					mData.mInt = reinterpret_cast<int32_t*>(mResource->Reallocate(mData.mInt, mCapacity * sizeof(int32_t), newCapacity * sizeof(int32_t)));
 					break;
 
 				case DatumType::FLOAT:
-					mData.mFloat = reinterpret_cast<float_t*>(realloc(mData.mFloat, newCapacity * sizeof(float_t)));
+					mData.mFloat = reinterpret_cast<float_t*>(mResource->Reallocate(mData.mFloat, mCapacity * sizeof(float_t), newCapacity * sizeof(float_t)));
 					break;
 
 				case DatumType::VECTOR4:
-					mData.mVec4 = reinterpret_cast<glm::vec4*>(realloc(mData.mVec4, newCapacity * sizeof(glm::vec4)));
+					mData.mVec4 = reinterpret_cast<glm::vec4*>(mResource->Reallocate(mData.mVec4, mCapacity * sizeof(glm::vec4), newCapacity * sizeof(glm::vec4)));
 					break;
 
 				case DatumType::MATRIX4X4:
-					mData.mMat4x4 = reinterpret_cast<glm::mat4x4*>(realloc(mData.mMat4x4, newCapacity * sizeof(glm::mat4x4)));
+					mData.mMat4x4 = reinterpret_cast<glm::mat4x4*>(mResource->Reallocate(mData.mMat4x4, mCapacity * sizeof(glm::mat4x4), newCapacity * sizeof(glm::mat4x4)));
 					break;
 
 				case DatumType::STRING:
-					mData.mString = reinterpret_cast<std::string*>(realloc(mData.mString, newCapacity * sizeof(std::string)));
+					ReallocateStrings(newCapacity);
 					break;
 
 				case DatumType::POINTER:
-					mData.mRTTI = reinterpret_cast<RTTI**>(realloc(mData.mRTTI, newCapacity * sizeof(RTTI*)));
+					mData.mRTTI = reinterpret_cast<RTTI**>(mResource->Reallocate(mData.mRTTI, mCapacity * sizeof(RTTI*), newCapacity * sizeof(RTTI*)));
 					break;
 				case DatumType::TABLE:
-					mData.mScope = reinterpret_cast<Scope**>(realloc(mData.mScope, newCapacity * sizeof(Scope*)));
+					mData.mScope = reinterpret_cast<Scope**>(mResource->Reallocate(mData.mScope, mCapacity * sizeof(Scope*), newCapacity * sizeof(Scope*)));
 					break;
 					
 				default:
@@ -310,10 +452,84 @@ namespace Library
 			}
 		}
 
+		void Datum::ShrinkToFit()
+		{
+			CompactTable();
+			if (mIsExternal || IsShared() || mData.vp == nullptr || IsInline() || mCapacity == mSize)
+			{
+				return;
+			}
+			BeginWrite();
+			if (mSize == 0)
+			{
+				Clear();
+				return;
+			}
+
+			size_t typeSize = DatumTypeSizes[static_cast<std::size_t>(mType)];
+			if (mType == DatumType::STRING)
+			{
+				ReallocateStrings(mSize);
+			}
+			else if (mSize * typeSize <= INLINE_STORAGE_SIZE)
+			{
+				memcpy(mInlineStorage, mData.vp, mSize * typeSize);
+				mResource->Deallocate(mData.vp, mCapacity * typeSize);
+				mData.vp = mInlineStorage;
+			}
+			else
+			{
+				mData.vp = mResource->Reallocate(mData.vp, mCapacity * typeSize, mSize * typeSize);
+			}
+			mCapacity = mSize;
+		}
+
+		MemoryFootprint Datum::Footprint() const
+		{
+			CompactTable();
+			MemoryFootprint footprint;
+			if (mIsExternal || mData.vp == nullptr || IsInline())
+			{
+				return footprint;
+			}
+
+			size_t typeSize = DatumTypeSizes[static_cast<std::size_t>(mType)];
+			if (IsShared())
+			{
+				footprint.DatumShared = mCapacity * typeSize;
+				return footprint;
+			}
+			footprint.DatumElements = mSize * typeSize;
+			footprint.DatumSlack = (mCapacity - mSize) * typeSize;
+			if (mType == DatumType::STRING)
+			{
+				for (size_t i = 0; i < mSize; ++i)
+				{
+					footprint.Strings += MemoryFootprint::HeapBytes(mData.mString[i]);
+				}
+			}
+			return footprint;
+		}
+
 		void Datum::Clear()
 		{
-			if (mCapacity > 0 && !IsExternal())
+			MarkModified();
+			if (!IsExternal())
 			{
+				if (mShareCount != nullptr)
+				{
+					if (--(*mShareCount.load()) > 0)
+					{
+						//Another Datum still owns the buffer and its elements
+						mShareCount = nullptr;
+						mData.vp = nullptr;
+						mSize = 0;
+						mCapacity = 0;
+						return;
+					}
+					mResource->Deallocate(mShareCount.load(), sizeof(std::atomic<size_t>));
+					mShareCount = nullptr;
+				}
 				if (mType == DatumType::STRING)
 				{
 					for (size_t i = 0; i < mSize; ++i)
@@ -321,11 +537,146 @@ namespace Library
 						mData.mString[i].std::string::~string();
 					}
 				}
-				free(mData.vp);
+				if (mData.vp != nullptr && !IsInline())
+				{
+					mResource->Deallocate(mData.vp, mCapacity * DatumTypeSizes[static_cast<std::size_t>(mType)]);
+				}
+				mData.vp = nullptr;
 				mSize = 0;
 				mCapacity = 0;
+				mTombstones = 0;
+			}
+		}
+
+		bool Datum::IsInline() const
+		{
+			return (mData.vp == mInlineStorage);
+		}
+
+		bool Datum::IsShared() const
+		{
+			std::atomic<size_t>* shareCount = mShareCount.load();
+			return (shareCount != nullptr && *shareCount > 1);
+		}
+
+		void Datum::MarkModified()
+		{
+			if (mOwner != nullptr)
+			{
+				mOwner->InvalidateStructuralHash();
+			}
+		}
+
+		void Datum::Tombstone(size_t index)
+		{
+			assert(mType == DatumType::TABLE && index < mSize);
+			MarkModified();
+			mData.mScope[index] = nullptr;
+			if (index + 1 == mSize)
+			{
+				//Tombstones that end up last are popped too, each at most once
+				--mSize;
+				while (mTombstones > 0 && mData.mScope[mSize - 1] == nullptr)
+				{
+					--mSize;
+					--mTombstones;
+				}
+			}
+			else
+			{
+				++mTombstones;
+			}
+		}
+
+		void Datum::RemoveTombstones()
+		{
+			size_t kept = 0;
+			for (size_t i = 0; i < mSize; ++i)
+			{
+				Scope* child = mData.mScope[i];
+				if (child != nullptr)
+				{
+					mData.mScope[kept] = child;
+					if (child->mParentDatum == this)
+					{
+						child->mParentIndex = kept;
+					}
+					++kept;
+				}
+			}
+			mSize = kept;
+			mTombstones = 0;
+		}
+
+		void Datum::BeginMutableView()
+		{
+			BeginWrite();
+			mHasMutableViews = true;
+		}
+
+		void Datum::BeginWrite()
+		{
+			MarkModified();
+			std::atomic<size_t>* shareCount = mShareCount.load();
+			if (shareCount == nullptr)
+			{
+				return;
+			}
+			if (*shareCount == 1)
+			{
+				mResource->Deallocate(shareCount, sizeof(std::atomic<size_t>));
+				mShareCount = nullptr;
+				return;
+			}
+
+			size_t typeSize = DatumTypeSizes[static_cast<std::size_t>(mType)];
+			void* buffer = mResource->Allocate(mCapacity * typeSize);
+			if (mType == DatumType::STRING)
+			{
+				std::string* strings = reinterpret_cast<std::string*>(buffer);
+				for (size_t i = 0; i < mSize; ++i)
+				{
+					new (strings + i)std::string(mData.mString[i]);
+				}
+			}
+			else
+			{
+				memcpy(buffer, mData.vp, mSize * typeSize);
+			}
+			--(*shareCount);
+			mShareCount = nullptr;
+			mData.vp = buffer;
+		}
+
+		MemoryResource& Datum::Resource() const
+		{
+			return *mResource;
+		}
+
+		GrowthStrategy Datum::GetGrowthStrategy() const
+		{
+			return mGrowthStrategy;
+		}
+
+		void Datum::SetGrowthStrategy(GrowthStrategy strategy)
+		{
+			if (strategy == nullptr)
+			{
+				throw std::runtime_error("Growth strategy cannot be null!");
+			}
+			mGrowthStrategy = strategy;
+		}
+
+		void Datum::Grow()
+		{
+			size_t newCapacity = mGrowthStrategy(mSize, mCapacity);
+			if (newCapacity <= mCapacity)
+			{
+				throw std::runtime_error("Growth strategy must increase the capacity!");
 			}
+			Reserve(newCapacity);
 		}
+
 		bool Datum::IsExternal() const
 		{
 			return mIsExternal;
@@ -341,6 +692,7 @@ namespace Library
 			{
 				Clear();
 			}
+			MarkModified();
 			mType = type;
 			mSize = arraySize;
 			mCapacity = arraySize;
@@ -385,17 +737,54 @@ namespace Library
 
 		void Datum::SetStorage(void* array, size_t arraySize)
 		{
+			if (!mIsExternal)
+			{
+				Clear();
+			}
+			MarkModified();
 			mIsExternal = true;
 			mSize = arraySize;
 			mCapacity = arraySize;
 			mData.vp = array;
 		}
 
+		size_t Datum::Hash() const
+		{
+			CompactTable();
+			std::uint64_t hash = IntegerHash((static_cast<std::uint64_t>(mType) << 32) ^ mSize);
+			switch (mType)
+			{
+			case DatumType::INTEGER:
+			case DatumType::FLOAT:
+			case DatumType::VECTOR4:
+			case DatumType::MATRIX4X4:
+				//operator== compares these bytewise, so equal Datums hash equal bytes
+				hash = ByteHash(mData.vp, mSize * DatumTypeSizes[static_cast<std::size_t>(mType)], hash);
+				break;
+			case DatumType::STRING:
+				for (size_t i = 0; i < mSize; ++i)
+				{
+					hash = ByteHash(mData.mString[i].data(), mData.mString[i].size(), hash);
+				}
+				break;
+			default:
+				break;
+			}
+			return static_cast<size_t>(hash);
+		}
+
 		bool Datum::operator==(const Datum& rhs) const
 		{
+			CompactTable();
+			rhs.CompactTable();
 			bool equal = true; 
 			if ((mType == rhs.mType) && (mSize == rhs.mSize))
 			{
+				if (mData.vp == rhs.mData.vp)
+				{
+					//Same Datum, or copies sharing one buffer
+					return true;
+				}
 				switch (mType)
 				{
 				case DatumType::STRING:
@@ -410,20 +799,23 @@ namespace Library
 					break;
 				case DatumType::TABLE:
 				case DatumType::POINTER:
-					for (size_t i = 0; i < mSize; ++i)
+				{
+					//Skip identical pointers in bulk, only the ones that differ need a call to Equals
+					const void* const* leftPointers = reinterpret_cast<const void* const*>(mData.vp);
+					const void* const* rightPointers = reinterpret_cast<const void* const*>(rhs.mData.vp);
+					for (size_t i = DatumMath::Mismatch(leftPointers, rightPointers, mSize); i < mSize; i += 1 + DatumMath::Mismatch(leftPointers + i + 1, rightPointers + i + 1, mSize - i - 1))
 					{
 						RTTI* leftPointer = mData.mRTTI[i];
-						RTTI* rightPointer = mData.mRTTI[i];
-						if (leftPointer != rightPointer && leftPointer != nullptr)
+						RTTI* rightPointer = rhs.mData.mRTTI[i];
+						//The pointers differ, so a null on either side is unequal; Equals overrides may dereference their argument
+						if (leftPointer == nullptr || rightPointer == nullptr || leftPointer->Equals(rightPointer) == false)
 						{
-							if (leftPointer->Equals(rightPointer) == false)
-							{
-								equal = false;
-								break;
-							}
+							equal = false;
+							break;
 						}
 					}
 					break;
+				}
 				default:
 					size_t typeSize = DatumTypeSizes[static_cast<std::size_t>(mType)] * mSize;
 					if (memcmp(mData.vp, rhs.mData.vp, typeSize) != 0)
@@ -507,6 +899,7 @@ namespace Library
 
 		void Datum::Set(const DatumType & type, size_t index)
 		{
+			CompactTable();
 			if (mType == DatumType::UNKNOWN)
 			{
 				mType = type;
@@ -522,6 +915,7 @@ namespace Library
 			{
 				throw std::exception("Index out of bounds!");
 			}
+			BeginWrite();
 		}
 
 		void Datum::Set(const int32_t& value, size_t index)
@@ -577,6 +971,7 @@ namespace Library
 			{
 				throw std::runtime_error("Type mismatch!");
 			}
+			BeginMutableView();
 			return mData.mInt[index];
 		}
 
@@ -591,6 +986,7 @@ namespace Library
 			{
 				throw std::runtime_error("Type mismatch!");
 			}
+			BeginMutableView();
 			return mData.mFloat[index];
 		}
 
@@ -605,6 +1001,7 @@ namespace Library
 			{
 				throw std::runtime_error("Type mismatch!");
 			}
+			BeginMutableView();
 			return mData.mVec4[index];
 		}
 
@@ -619,6 +1016,7 @@ namespace Library
 			{
 				throw std::runtime_error("Type mismatch!");
 			}
+			BeginMutableView();
 			return mData.mMat4x4[index];
 		}
 
@@ -633,6 +1031,7 @@ namespace Library
 			{
 				throw std::runtime_error("Type mismatch!");
 			}
+			BeginMutableView();
 			return mData.mString[index];
 		}
 
@@ -647,12 +1046,14 @@ namespace Library
 			{
 				throw std::runtime_error("Type mismatch!");
 			}
+			BeginMutableView();
 			return mData.mRTTI[index];
 		}
 
 		template<>
 		Scope& Datum::Get<Scope>(size_t index)
 		{
+			CompactTable();
 			if (index >= mSize)
 			{
 				throw std::runtime_error("Index out of bounds!");
@@ -751,6 +1152,7 @@ namespace Library
 		template<>
 		Scope const& Datum::Get<Scope>(size_t index) const 
 		{
+			CompactTable();
 			if (index >= mSize)
 			{
 				throw std::runtime_error("Index out of bounds!");
@@ -762,7 +1164,7 @@ namespace Library
 			return *mData.mScope[index];
 		}
 
-		void Datum::SetFromString(const std::string& string, size_t index)
+		void Datum::SetFromString(std::string_view string, size_t index)
 		{
 			if (mType == DatumType::UNKNOWN)
 			{
@@ -774,50 +1176,66 @@ namespace Library
 
 			}
 
-			std::stringstream input_string(string);
-
+			bool parsed = false;
 			switch (mType)
 			{
 			case DatumType::INTEGER:
-				int32_t temp_int;
-				input_string >> temp_int;
-				Set(temp_int, index);
+			{
+				int32_t value;
+				if ((parsed = NumericText::Parse(string, value)))
+				{
+					Set(value, index);
+				}
 				break;
+			}
 			case DatumType::FLOAT:
-				float_t temp_float;
-				input_string >> temp_float;
-				Set(temp_float, index);
+			{
+				float_t value;
+				if ((parsed = NumericText::Parse(string, value)))
+				{
+					Set(value, index);
+				}
 				break;
+			}
 			case DatumType::VECTOR4:
-				glm::vec4 temp_vec;
-				sscanf_s(string.c_str(), "vec4(%f,%f,%f,%f)", &temp_vec.x, &temp_vec.y, &temp_vec.z, &temp_vec.w);
-				Set(temp_vec, index);
+			{
+				glm::vec4 value;
+				if ((parsed = NumericText::Parse(string, value)))
+				{
+					Set(value, index);
+				}
 				break;
+			}
 			case DatumType::MATRIX4X4:
-				glm::mat4 temp_mat;
-				sscanf_s(string.c_str(), "mat4x4((%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f))",
-					&temp_mat[0][0], &temp_mat[0][1], &temp_mat[0][2], &temp_mat[0][3],
-					&temp_mat[1][0], &temp_mat[1][1], &temp_mat[1][2], &temp_mat[1][3],
-					&temp_mat[2][0], &temp_mat[2][1], &temp_mat[2][2], &temp_mat[2][3],
-					&temp_mat[3][0], &temp_mat[3][1], &temp_mat[3][2], &temp_mat[3][3]);
-				Set(temp_mat, index);
+			{
+				glm::mat4 value;
+				if ((parsed = NumericText::Parse(string, value)))
+				{
+					Set(value, index);
+				}
 				break;
+			}
 			case DatumType::STRING:
-				Set(string, index);
+				Set(std::string(string), index);
+				parsed = true;
 				break;
 			case DatumType::POINTER:
 				throw std::runtime_error("Cannot set RTTI pointer from a string");
-				break;
 			case DatumType::TABLE:
 				throw std::runtime_error("Cannot set Scope pointer from a string");
 			default:
 				throw std::runtime_error("Invalid data type!");
+			}
 
+			if (!parsed)
+			{
+				throw std::runtime_error("String does not hold a value of the Datum's type!");
 			}
 		}
 
 		std::string Datum::ToString(size_t index)
 		{
+			CompactTable();
 			if (mType == DatumType::UNKNOWN)
 			{
 				throw std::runtime_error("Invalid datum type!");
@@ -827,33 +1245,36 @@ namespace Library
 				throw std::runtime_error("Index is out of bounds!");
 			}
 			
+			//Read through the const accessors so converting a shared buffer does not copy it
+			const Datum& self = *this;
 			std::string output;
 
 			switch (mType)
 			{
 			case DatumType::INTEGER:
-				output = std::to_string(Get<int32_t>(index));
+				output = NumericText::Format(self.Get<int32_t>(index));
 				break;
 			case DatumType::FLOAT:
-				output = std::to_string(Get<float_t>(index));
+				output = NumericText::Format(self.Get<float_t>(index));
 				break;
 			case DatumType::VECTOR4:
-				output = glm::to_string(Get<glm::vec4>(index));
+				output = NumericText::Format(self.Get<glm::vec4>(index));
 				break;
 			case DatumType::MATRIX4X4:
-				output = glm::to_string(Get<glm::mat4x4>(index));
+				output = NumericText::Format(self.Get<glm::mat4x4>(index));
 				break;
 			case DatumType::STRING:
-				output = Get<std::string>(index);
+				output = self.Get<std::string>(index);
 				break;
 			case DatumType::POINTER:
 				if (mData.mRTTI[index] != nullptr)
-					output = (Get<RTTI*>(index))->ToString();
+					output = (self.Get<RTTI*>(index))->ToString();
 				break;
 			case DatumType::TABLE:
 				output = "Scope";
+				break;
 			default:
-				throw std::exception("Invalid data type!");
+				throw std::runtime_error("Invalid data type!");
 			}
 			return output;
 		}
@@ -875,9 +1296,10 @@ namespace Library
 				throw std::runtime_error("Datum type mismatch!");
 			}
 
+			BeginWrite();
 			if (mCapacity == mSize)
 			{
-				Reserve(mCapacity * 2 + 1);
+				Grow();
 			}
 
 			mData.mInt[mSize] = item;
@@ -901,9 +1323,10 @@ namespace Library
 				throw std::runtime_error("Datum type mismatch!");
 			}
 
+			BeginWrite();
 			if (mCapacity == mSize)
 			{
-				Reserve(mCapacity * 2 + 1);
+				Grow();
 			}
 
 			mData.mFloat[mSize] = item;
@@ -927,9 +1350,10 @@ namespace Library
 				throw std::runtime_error("Datum type mismatch!");
 			}
 
+			BeginWrite();
 			if (mCapacity == mSize)
 			{
-				Reserve(mCapacity * 2 + 1);
+				Grow();
 			}
 
 			mData.mVec4[mSize] = item;
@@ -953,9 +1377,10 @@ namespace Library
 				throw std::runtime_error("Datum type mismatch!");
 			}
 
+			BeginWrite();
 			if (mCapacity == mSize)
 			{
-				Reserve(mCapacity * 2 + 1);
+				Grow();
 			}
 
 			mData.mMat4x4[mSize] = item;
@@ -979,9 +1404,10 @@ namespace Library
 				throw std::runtime_error("Datum type mismatch!");
 			}
 
+			BeginWrite();
 			if (mCapacity == mSize)
 			{
-				Reserve(mCapacity * 2 + 1);
+				Grow();
 			}
 			new (mData.mString + mSize) std::string(item);
 			mSize++;
@@ -1004,9 +1430,10 @@ namespace Library
 				throw std::runtime_error("Datum type mismatch!");
 			}
 
+			BeginWrite();
 			if (mCapacity == mSize)
 			{
-				Reserve(mCapacity * 2 + 1);
+				Grow();
 			}
 
 			mData.mRTTI[mSize] = item;
@@ -1030,9 +1457,10 @@ namespace Library
 				throw std::runtime_error("Datum type mismatch!");
 			}
 
+			BeginWrite();
 			if (mCapacity == mSize)
 			{
-				Reserve(mCapacity * 2 + 1);
+				Grow();
 			}
 			mData.mScope[mSize] = &item;
 			mSize++;
@@ -1040,6 +1468,7 @@ namespace Library
 
 		void Datum::PopBack()
 		{
+			CompactTable();
 			if (mSize == 0)
 			{
 				throw std::runtime_error("Cannot call PopBack on empty datum!");
@@ -1050,6 +1479,7 @@ namespace Library
 				throw std::runtime_error("Cannot call PopBack on external memory!");
 			}
 
+			BeginWrite();
 			mSize--;
 			switch (mType)
 			{
@@ -1071,6 +1501,7 @@ namespace Library
 				break;
 			case DatumType::TABLE:
 				mData.mScope[mSize] = nullptr;
+				break;
 			default:
 				mSize++;
 				throw std::runtime_error("Invalid data type!");
@@ -1329,14 +1760,9 @@ namespace Library
 			}
 
 			size_t index = Find(item);
-
 			if (index < mSize)
 			{
-				for (; index < mSize - 1; ++index)
-				{
-					mData.mInt[index] = mData.mInt[index + 1];
-				}
-				mSize--;
+				RemoveAt(index);
 				return true;
 			}
 			return false;
@@ -1354,14 +1780,9 @@ namespace Library
 			}
 
 			size_t index = Find(item);
-
 			if (index < mSize)
 			{
-				for (; index < mSize - 1; ++index)
-				{
-					mData.mFloat[index] = mData.mFloat[index + 1];
-				}
-				mSize--;
+				RemoveAt(index);
 				return true;
 			}
 			return false;
@@ -1379,14 +1800,9 @@ namespace Library
 			}
 
 			size_t index = Find(item);
-
 			if (index < mSize)
 			{
-				for (; index < mSize - 1; ++index)
-				{
-					mData.mVec4[index] = mData.mVec4[index + 1];
-				}
-				mSize--;
+				RemoveAt(index);
 				return true;
 			}
 			return false;
@@ -1404,14 +1820,9 @@ namespace Library
 			}
 
 			size_t index = Find(item);
-
 			if (index < mSize)
 			{
-				for (; index < mSize - 1; ++index)
-				{
-					mData.mMat4x4[index] = mData.mMat4x4[index + 1];
-				}
-				mSize--;
+				RemoveAt(index);
 				return true;
 			}
 			return false;
@@ -1429,15 +1840,9 @@ namespace Library
 			}
 
 			size_t index = Find(item);
-
 			if (index < mSize)
 			{
-				for (; index < mSize - 1; ++index)
-				{
-					mData.mString[index] = std::move(mData.mString[index + 1]);
-				}
-				mData.mString[mSize - 1].~basic_string();
-				mSize--;
+				RemoveAt(index);
 				return true;
 			}
 			return false;
@@ -1455,14 +1860,9 @@ namespace Library
 			}
 
 			size_t index = Find(item);
-
 			if (index < mSize)
 			{
-				for (; index < mSize - 1; ++index)
-				{
-					mData.mRTTI[index] = mData.mRTTI[index + 1];
-				}
-				mSize--;
+				RemoveAt(index);
 				return true;
 			}
 			return false;
@@ -1482,11 +1882,7 @@ namespace Library
 			size_t index = Find(item);
 			if (index < mSize)
 			{
-				for (; index < mSize - 1; ++index)
-				{
-					mData.mScope[index] = mData.mScope[index + 1];
-				}
-				mSize--;
+				RemoveAt(index);
 				return true;
 			}
 			return false;
@@ -1494,6 +1890,7 @@ namespace Library
 
 		void Datum::RemoveAt(size_t index)
 		{
+			CompactTable();
 			if (mIsExternal)
 			{
 				throw std::runtime_error("Cannot alter values in external memory!");
@@ -1507,112 +1904,32 @@ namespace Library
 				throw std::runtime_error("Out of bounds!");
 			}
 
-			switch (mType)
+			BeginWrite();
+			if (mType == DatumType::STRING)
 			{
-			case DatumType::INTEGER:
-				for (size_t i = index; i < mSize - 1; ++i)
-				{
-					mData.mInt[i] = mData.mInt[i + 1];
-				}
-				break;
-			case DatumType::FLOAT:
-				for (size_t i = index; i < mSize - 1; ++i)
-				{
-					mData.mFloat[i] = mData.mFloat[i + 1];
-				}
-				break;
-			case DatumType::VECTOR4:
-				for (size_t i = index; i < mSize - 1; ++i)
-				{
-					mData.mVec4[i] = mData.mVec4[i + 1];
-				}
-				break;
-			case DatumType::MATRIX4X4:
 				for (size_t i = index; i < mSize - 1; ++i)
 				{
-					mData.mMat4x4[i] = mData.mMat4x4[i + 1];
-				}
-				break;
-			case DatumType::STRING:
-				for (size_t i = index; i < mSize - 1; ++i)
-				{
-					mData.mString[i] = mData.mString[i + 1];
+					mData.mString[i] = std::move(mData.mString[i + 1]);
 				}
 				mData.mString[mSize - 1].~basic_string();
-				break;
-			case DatumType::POINTER:
-				for (size_t i = index; i < mSize - 1; ++i)
-				{
-					mData.mRTTI[i] = mData.mRTTI[i + 1];
-				}
-				break;
-			case DatumType::TABLE:
-				for (size_t i = index; i < mSize - 1; ++i)
-				{
-					mData.mScope[i] = mData.mScope[i + 1];
-				}
-			default:
-				throw std::runtime_error("Datum type is not set!");
+			}
+			else
+			{
+				//Every other type is trivially copyable, so the tail moves down in one memmove
+				size_t typeSize = DatumTypeSizes[static_cast<std::size_t>(mType)];
+				memmove(mData.bytes + index * typeSize, mData.bytes + (index + 1) * typeSize, (mSize - index - 1) * typeSize);
 			}
 			mSize--;
 		}
 
 		size_t Datum::Find(const int32_t & item)
 		{
-			if (mType == DatumType::UNKNOWN || mType != DatumType::INTEGER)
-			{
-				throw std::runtime_error("Invalid datum types!");
-			}
-
-			size_t index = 0;
-			bool found = false;
-
-			for (size_t i = 0; i < mSize; ++i)
-			{
-				index = i;
-				if (item == mData.mInt[i])
-				{
-					found = true;
-					break;
-				}
-			}
-			if (found)
-			{
-				return index;
-			}
-			else
-			{
-				return mSize;
-			}
+			return static_cast<const Datum&>(*this).Find(item);
 		}
 
 		size_t Datum::Find(const float_t & item)
 		{
-			if (mType == DatumType::UNKNOWN || mType != DatumType::FLOAT)
-			{
-				throw std::runtime_error("Invalid datum types!");
-			}
-
-			size_t index = 0;
-			bool found = false;
-
-			for (size_t i = 0; i < mSize; ++i)
-			{
-				index = i;
-				if (item == mData.mFloat[i])
-				{
-					found = true;
-					break;
-				}
-			}
-			if (found)
-			{
-				return index;
-			}
-			else
-			{
-				return mSize;
-			}
+			return static_cast<const Datum&>(*this).Find(item);
 		}
 
 		size_t Datum::Find(const glm::vec4 & item)
@@ -1704,60 +2021,12 @@ namespace Library
 
 		size_t Datum::Find(const RTTI& item)
 		{
-			if (mType == DatumType::UNKNOWN || mType != DatumType::POINTER)
-			{
-				throw std::runtime_error("Invalid datum types!");
-			}
-
-			size_t index = 0;
-			bool found = false;
-
-			for (size_t i = 0; i < mSize; ++i)
-			{
-				index = i;
-				if (&item == mData.mRTTI[i])
-				{
-					found = true;
-					break;
-				}
-			}
-			if (found)
-			{
-				return index;
-			}
-			else
-			{
-				return mSize;
-			}
+			return static_cast<const Datum&>(*this).Find(item);
 		}
 
 		size_t Datum::Find(const Scope& item)
 		{
-			if (mType == DatumType::UNKNOWN || mType != DatumType::TABLE)
-			{
-				throw std::runtime_error("Invalid datum types!");
-			}
-
-			size_t index = 0;
-			bool found = false;
-
-			for (size_t i = 0; i < mSize; ++i)
-			{
-				index = i;
-				if (&item == mData.mScope[i])
-				{
-					found = true;
-					break;
-				}
-			}
-			if (found)
-			{
-				return index;
-			}
-			else
-			{
-				return mSize;
-			}
+			return static_cast<const Datum&>(*this).Find(item);
 		}
 
 		const size_t Datum::Find(const int32_t& item) const
@@ -1766,27 +2035,7 @@ namespace Library
 			{
 				throw std::runtime_error("Invalid datum types!");
 			}
-
-			size_t index = 0;
-			bool found = false;
-
-			for (size_t i = 0; i < mSize; ++i)
-			{
-				index = i;
-				if (item == mData.mInt[i])
-				{
-					found = true;
-					break;
-				}
-			}
-			if (found)
-			{
-				return index;
-			}
-			else
-			{
-				return mSize;
-			}
+			return DatumMath::Find(mData.mInt, mSize, item);
 		}
 
 		const size_t Datum::Find(const float_t& item) const
@@ -1795,27 +2044,7 @@ namespace Library
 			{
 				throw std::runtime_error("Invalid datum types!");
 			}
-
-			size_t index = 0;
-			bool found = false;
-
-			for (size_t i = 0; i < mSize; ++i)
-			{
-				index = i;
-				if (item == mData.mFloat[i])
-				{
-					found = true;
-					break;
-				}
-			}
-			if (found)
-			{
-				return index;
-			}
-			else
-			{
-				return mSize;
-			}
+			return DatumMath::Find(mData.mFloat, mSize, item);
 		}
 
 		const size_t Datum::Find(const glm::vec4& item) const
@@ -1911,56 +2140,17 @@ namespace Library
 			{
 				throw std::runtime_error("Invalid datum types!");
 			}
-
-			size_t index = 0;
-			bool found = false;
-
-			for (size_t i = 0; i < mSize; ++i)
-			{
-				index = i;
-				if (&item == mData.mRTTI[i])
-				{
-					found = true;
-					break;
-				}
-			}
-			if (found)
-			{
-				return index;
-			}
-			else
-			{
-				return mSize;
-			}
+			return DatumMath::Find(reinterpret_cast<const void* const*>(mData.mRTTI), mSize, &item);
 		}
 
 		const size_t Datum::Find(const Scope& item) const
 		{
+			CompactTable();
 			if (mType == DatumType::UNKNOWN || mType != DatumType::TABLE)
 			{
 				throw std::runtime_error("Invalid datum types!");
 			}
-
-			size_t index = 0;
-			bool found = false;
-
-			for (size_t i = 0; i < mSize; ++i)
-			{
-				index = i;
-				if (&item == mData.mScope[i])
-				{
-					found = true;
-					break;
-				}
-			}
-			if (found)
-			{
-				return index;
-			}
-			else
-			{
-				return mSize;
-			}
+			return DatumMath::Find(reinterpret_cast<const void* const*>(mData.mScope), mSize, &item);
 		}
 
 		Scope& Datum::operator[](size_t index)
@@ -8,11 +8,18 @@
 #include <glm/glm.hpp>
 #include <glm/gtx/string_cast.hpp>
 #pragma warning(pop)
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <sstream>
 #include <tuple>
 #include "HashMap.h"
+#include "MemoryResource.h"
+#include "GrowthStrategy.h"
+#include "MemoryFootprint.h"
+#include "Span.h"
 
 
 namespace Library
@@ -22,6 +29,37 @@ namespace Library
 	/// </summary>
 	class Scope;
 
+	/// <summary>
+	/// While alive, copies of Datums made on the calling thread share the source's heap buffer instead of copying it. Either
+	/// side copies the buffer the first time it is written to, through any non-const accessor, so sharing is never visible.
+	/// A source that has handed out a mutable reference or span is copied deeply, since writes through it go unseen. The
+	/// share count is atomic, so several threads may copy the same const source, e.g. a prototype, at once.
+	/// </summary>
+	class CopyOnWriteGuard final
+	{
+	public:
+		/// <summary>
+		/// Turns sharing on
+		/// </summary>
+		CopyOnWriteGuard();
+		CopyOnWriteGuard(const CopyOnWriteGuard&) = delete;
+		CopyOnWriteGuard& operator=(const CopyOnWriteGuard&) = delete;
+
+		/// <summary>
+		/// Restores the previous setting
+		/// </summary>
+		~CopyOnWriteGuard();
+
+		/// <summary>
+		/// Checks whether a guard is alive on the calling thread
+		/// </summary>
+		/// <returns>True if copies share buffers</returns>
+		static bool IsActive();
+
+	private:
+		bool mPrevious;
+	};
+
 	/// <summary>
 	/// Runtime polymorphic vector
 	/// </summary>
@@ -29,6 +67,9 @@ namespace Library
 	{
 
 		friend class Attributed;
+		friend class Scope;
+		friend class DatumMath;
+		template <typename T> friend class DatumRef;
 
 	public: 
 
@@ -54,13 +95,19 @@ namespace Library
 		/// </summary>
 		Datum();
 
+		/// <summary>
+		/// Constructor that allocates heap storage from the provided resource instead of the default one
+		/// </summary>
+		/// <param name="resource">Resource the elements are allocated from once they outgrow the inline storage</param>
+		explicit Datum(MemoryResource& resource);
+
 		/// <summary>
 		/// Destructor
 		/// </summary>
 		~Datum();
 
 		/// <summary>
-		/// Copy constructor
+		/// Copy constructor, the copy allocates from the default resource
 		/// </summary>
 		/// <param name="rhs">Const R-Value reference that will be copied</param>
 		Datum(const Datum& rhs);
@@ -123,17 +170,68 @@ namespace Library
 		size_t Capacity() const;
 
 		/// <summary>
-		/// Set's number of values for Datum, reserves memory if needed (supports shrinking and growing)
+		/// Provides the number of slots that orphaned children left in a table. They are removed in one ordered pass the
+		/// next time the table is read by index or size, so orphaning a child never shifts its siblings.
+		/// </summary>
+		/// <returns>Number of pending tombstones, 0 for any other type</returns>
+		size_t TombstoneCount() const;
+
+		/// <summary>
+		/// Set's number of values for Datum, reserves memory if needed (supports shrinking and growing). Growing within the
+		/// capacity keeps it, shrinking releases the unused capacity.
 		/// </summary>
 		/// <param name="size">New size for Datum</param>
 		void Resize(size_t newSize);
 
 		/// <summary>
-		/// Allocates/reallocates elements based on new capacity
+		/// Allocates/reallocates elements based on new capacity. Capacities that fit in INLINE_STORAGE_SIZE bytes
+		/// use storage inside the Datum itself, the heap is only used once the Datum grows past it.
 		/// </summary>
 		/// <param name="newCapacity">New capacity for Datum</param>
 		void Reserve(size_t newCapacity);
 
+		/// <summary>
+		/// Releases the capacity past the size, moving the elements back into the inline storage when they fit. External
+		/// storage and buffers shared copy-on-write are left alone.
+		/// </summary>
+		void ShrinkToFit();
+
+		/// <summary>
+		/// Reports the heap bytes of the elements, string payloads included. Nested scopes are reported by Scope::Footprint.
+		/// </summary>
+		/// <returns>Used and slack bytes by category</returns>
+		MemoryFootprint Footprint() const;
+
+		/// <summary>
+		/// Determines whether the elements are stored inside the Datum rather than on the heap
+		/// </summary>
+		/// <returns>True if storage is inline, false if not</returns>
+		bool IsInline() const;
+
+		/// <summary>
+		/// Determines whether the heap buffer is shared with a copy made under a CopyOnWriteGuard
+		/// </summary>
+		/// <returns>True if another Datum reads the same buffer</returns>
+		bool IsShared() const;
+
+		/// <summary>
+		/// Provides the resource heap storage is allocated from
+		/// </summary>
+		/// <returns>Reference to the memory resource</returns>
+		MemoryResource& Resource() const;
+
+		/// <summary>
+		/// Provides the strategy used to grow a full Datum
+		/// </summary>
+		/// <returns>Growth strategy</returns>
+		GrowthStrategy GetGrowthStrategy() const;
+
+		/// <summary>
+		/// Replaces the strategy used to grow a full Datum, copies and moves carry it along
+		/// </summary>
+		/// <param name="strategy">New growth strategy</param>
+		void SetGrowthStrategy(GrowthStrategy strategy);
+
 		/// <summary>
 		/// Clears Datum, does not alter capacity
 		/// </summary>
@@ -145,6 +243,13 @@ namespace Library
 		/// <returns>True if external, false if internal</returns>
 		bool IsExternal() const;
 
+		/// <summary>
+		/// Hashes the type, the size and the elements, consistently with operator==. Pointers contribute only their
+		/// count, as they compare by their pointee, and nested scopes are hashed by Scope::StructuralHash.
+		/// </summary>
+		/// <returns>Hash of the Datum</returns>
+		size_t Hash() const;
+
 		/// <summary>
 		/// Assigns internal values array to the given array, sets size and capacity
 		/// </summary>
@@ -263,14 +368,55 @@ namespace Library
 		template <> const Scope& Get<Scope>(size_t index) const;
 
 		/// <summary>
-		/// Assigns element in values array to given value via provided string
+		/// Views every element as one contiguous span, checking the type once instead of on every access. T is int32_t,
+		/// float_t, glm::vec4, glm::mat4x4, std::string or RTTI*. A shared buffer is copied first, as with Get. The span is
+		/// invalidated by anything that reallocates or shrinks the Datum.
+		/// </summary>
+		/// <returns>Span over the elements, empty if the Datum has no type yet</returns>
+		template <typename T> Span<T> AsSpan();
+
+		/// <summary>
+		/// Const version of AsSpan
+		/// </summary>
+		/// <returns>Const span over the elements, empty if the Datum has no type yet</returns>
+		template <typename T> Span<const T> AsSpan() const;
+
+		/// <summary>
+		/// Overwrites existing elements, starting at the provided index, with a range of values. Numbers, vectors, matrices and
+		/// pointers are copied with a single memcpy.
+		/// </summary>
+		/// <param name="index">Index of the first element to overwrite</param>
+		/// <param name="first">Pointer to the first value, must not point into this Datum</param>
+		/// <param name="last">Pointer past the last value</param>
+		template <typename T> void SetRange(size_t index, const T* first, const T* last);
+
+		/// <summary>
+		/// Appends a range of values, growing the array at most once. Sets the type of an untyped Datum. The range may be
+		/// elements of this Datum, they are read from the new buffer when the array grows.
+		/// </summary>
+		/// <param name="first">Pointer to the first value</param>
+		/// <param name="last">Pointer past the last value</param>
+		template <typename T> void PushBackRange(const T* first, const T* last);
+
+		/// <summary>
+		/// Replaces the elements with a range of values, reusing the current buffer when it is large enough. Sets the type of an
+		/// untyped Datum. A range of this Datum's own elements is slid to the front instead of copied.
+		/// </summary>
+		/// <param name="first">Pointer to the first value</param>
+		/// <param name="last">Pointer past the last value</param>
+		template <typename T> void Assign(const T* first, const T* last);
+
+		/// <summary>
+		/// Assigns element in values array to given value via provided string. Numbers, vectors and matrices are parsed by
+		/// NumericText, independently of the locale.
 		/// </summary>
 		/// <param name="string">Provided string</param>
 		/// <param name="index">Provided index</param>
-		void SetFromString(const std::string& string, size_t index = 0);
+		void SetFromString(std::string_view string, size_t index = 0);
 
 		/// <summary>
-		/// Provides string representing element in the values array at provided index
+		/// Provides string representing element in the values array at provided index. Numbers, vectors and matrices are
+		/// formatted by NumericText, so SetFromString reads the text back to the exact same value.
 		/// </summary>
 		/// <param name="index">Provided index</param>
 		/// <returns>Element represented as a string</returns>
@@ -373,10 +519,84 @@ namespace Library
 
 		const static HashMap<std::string, Datum::DatumType> StringDatumTypeHashMap;
 
+		/// <summary>
+		/// Number of bytes of element storage held inside every Datum -- one int, float, vec4 or pointer, or a few of them
+		/// </summary>
+		static const size_t INLINE_STORAGE_SIZE = 16;
+
 	private:
 
+		/// <summary>
+		/// Maps an element type to its DatumType, specialized in Datum.inl
+		/// </summary>
+		template <typename T> struct TypeOf;
+
+		/// <summary>
+		/// Copies values into raw memory at the end of the array or over live elements. Strings are copy constructed or
+		/// assigned, everything else is copied bytewise.
+		/// </summary>
+		/// <param name="destination">First element to write</param>
+		/// <param name="first">Pointer to the first value</param>
+		/// <param name="count">Number of values</param>
+		/// <param name="isConstructed">True if the destination already holds live elements</param>
+		template <typename T> static void CopyRange(T* destination, const T* first, size_t count, bool isConstructed);
+
+		/// <summary>
+		/// Finds the index of a value within the elements, so a range taken from this Datum can be found again after the
+		/// buffer is reallocated or its elements are destroyed
+		/// </summary>
+		/// <param name="value">Pointer to a value</param>
+		/// <returns>Index of the element, Size() if the value is not an element of this Datum</returns>
+		template <typename T> size_t IndexOfElement(const T* value) const;
+
 		void SetStorage(void* array, size_t arraySize);
 
+		/// <summary>
+		/// Moves the strings into a new block from the resource, std::string may point into itself so it cannot be moved bytewise
+		/// </summary>
+		/// <param name="newCapacity">Number of strings the new block holds</param>
+		void ReallocateStrings(size_t newCapacity);
+
+		/// <summary>
+		/// Called before anything writes to the elements: gives the Datum its own copy of a shared buffer and marks the
+		/// structural hash of the owning scope stale
+		/// </summary>
+		void BeginWrite();
+
+		/// <summary>
+		/// Called before a reference, pointer or span to the elements is handed out: begins the write and marks the Datum
+		/// volatile, since later writes through what was handed out go unseen
+		/// </summary>
+		void BeginMutableView();
+
+		/// <summary>
+		/// Marks the structural hash of the owning scope, and of its ancestors, stale
+		/// </summary>
+		void MarkModified();
+
+		/// <summary>
+		/// Grows a full Datum according to the growth strategy
+		/// </summary>
+		void Grow();
+
+		/// <summary>
+		/// Empties the slot of an orphaned child in amortized constant time. The last slot is popped along with the
+		/// tombstones before it, any other becomes a tombstone.
+		/// </summary>
+		/// <param name="index">Raw index of the slot, which may lie past tombstones that are not removed yet</param>
+		void Tombstone(size_t index);
+
+		/// <summary>
+		/// Removes the tombstones of a table before anything reads it by index or size. A table never holds null slots
+		/// other than tombstones, so this is a no-op unless a child was orphaned since the last read.
+		/// </summary>
+		void CompactTable() const;
+
+		/// <summary>
+		/// Slides the live children of a table over its tombstones, keeping their order and recording their new indices
+		/// </summary>
+		void RemoveTombstones();
+
 		/// <summary>
 		/// Union for storing pointer
 		/// </summary>
@@ -399,5 +619,32 @@ namespace Library
 		size_t mSize = 0;
 		size_t mCapacity = 0;
 		bool mIsExternal = false;
+
+		/// <summary>
+		/// Number of null slots orphaned children left in a table, counted in mSize until CompactTable removes them
+		/// </summary>
+		size_t mTombstones = 0;
+
+		/// <summary>
+		/// Number of Datums sharing the heap buffer, allocated from the resource when the buffer is first shared. Both the
+		/// pointer and the count are atomic because a const source may be copied from several threads at once.
+		/// </summary>
+		mutable std::atomic<std::atomic<size_t>*> mShareCount{ nullptr };
+
+		/// <summary>
+		/// Set once a mutable reference or span has been handed out, so the owning scope rehashes this Datum on every
+		/// StructuralHash instead of trusting its cache, and copies never share its buffer. Never cleared, the reference may outlive any call that could.
+		/// </summary>
+		bool mHasMutableViews = false;
+
+		/// <summary>
+		/// Scope whose lookup table holds this Datum, set by the scope. It identifies the slot, so it is never copied or moved.
+		/// </summary>
+		Scope* mOwner = nullptr;
+		MemoryResource* mResource = &MemoryResource::Default();
+		GrowthStrategy mGrowthStrategy = GrowthStrategyGuard::Current(&DoublingStrategy::Grow);
+		alignas(std::max_align_t) std::uint8_t mInlineStorage[INLINE_STORAGE_SIZE];
 	};
-}
\ No newline at end of file
+}
+
+#include "Datum.inl"
\ No newline at end of file
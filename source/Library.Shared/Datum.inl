@@ -0,0 +1,212 @@
+#pragma once
+#include "Datum.h"
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+namespace Library
+{
+	template <> struct Datum::TypeOf<std::int32_t> { static constexpr Datum::DatumType Value = Datum::DatumType::INTEGER; };
+	template <> struct Datum::TypeOf<std::float_t> { static constexpr Datum::DatumType Value = Datum::DatumType::FLOAT; };
+	template <> struct Datum::TypeOf<glm::vec4> { static constexpr Datum::DatumType Value = Datum::DatumType::VECTOR4; };
+	template <> struct Datum::TypeOf<glm::mat4x4> { static constexpr Datum::DatumType Value = Datum::DatumType::MATRIX4X4; };
+	template <> struct Datum::TypeOf<std::string> { static constexpr Datum::DatumType Value = Datum::DatumType::STRING; };
+	template <> struct Datum::TypeOf<RTTI*> { static constexpr Datum::DatumType Value = Datum::DatumType::POINTER; };
+
+	template <typename T>
+	inline Span<T> Datum::AsSpan()
+	{
+		if (mType == DatumType::UNKNOWN)
+		{
+			return Span<T>();
+		}
+		if (mType != TypeOf<T>::Value)
+		{
+			throw std::runtime_error("Type mismatch!");
+		}
+		BeginMutableView();
+		return Span<T>(reinterpret_cast<T*>(mData.vp), mSize);
+	}
+
+	template <typename T>
+	inline Span<const T> Datum::AsSpan() const
+	{
+		if (mType == DatumType::UNKNOWN)
+		{
+			return Span<const T>();
+		}
+		if (mType != TypeOf<T>::Value)
+		{
+			throw std::runtime_error("Type mismatch!");
+		}
+		return Span<const T>(reinterpret_cast<const T*>(mData.vp), mSize);
+	}
+
+	template <typename T>
+	inline void Datum::SetRange(size_t index, const T* first, const T* last)
+	{
+		if (mType != TypeOf<T>::Value)
+		{
+			throw std::runtime_error("Type mismatch!");
+		}
+		size_t count = static_cast<size_t>(last - first);
+		if (index > mSize || count > mSize - index)
+		{
+			throw std::runtime_error("Index out of bounds!");
+		}
+		if (count == 0)
+		{
+			return;
+		}
+
+		BeginWrite();
+		CopyRange(reinterpret_cast<T*>(mData.vp) + index, first, count, true);
+	}
+
+	template <typename T>
+	inline void Datum::PushBackRange(const T* first, const T* last)
+	{
+		if (mIsExternal)
+		{
+			throw std::runtime_error("Cannot write to external storage!");
+		}
+		if (mType == DatumType::UNKNOWN)
+		{
+			SetType(TypeOf<T>::Value);
+		}
+		if (mType != TypeOf<T>::Value)
+		{
+			throw std::runtime_error("Datum type mismatch!");
+		}
+		size_t count = static_cast<size_t>(last - first);
+		if (count == 0)
+		{
+			return;
+		}
+
+		//Growing or unsharing may release the buffer the range points into, so find it again by index afterwards
+		size_t index = IndexOfElement(first);
+		size_t newSize = mSize + count;
+		if (mCapacity < newSize)
+		{
+			//Grow once, still by the growth strategy so repeated small ranges stay amortized
+			Reserve(std::max(newSize, mGrowthStrategy(mSize, mCapacity)));
+		}
+		else
+		{
+			BeginWrite();
+		}
+		if (index < mSize)
+		{
+			first = reinterpret_cast<const T*>(mData.vp) + index;
+		}
+		CopyRange(reinterpret_cast<T*>(mData.vp) + mSize, first, count, false);
+		mSize = newSize;
+	}
+
+	template <typename T>
+	inline void Datum::Assign(const T* first, const T* last)
+	{
+		if (mIsExternal)
+		{
+			throw std::runtime_error("Cannot write to external storage!");
+		}
+		if (mType == DatumType::UNKNOWN)
+		{
+			SetType(TypeOf<T>::Value);
+		}
+		if (mType != TypeOf<T>::Value)
+		{
+			throw std::runtime_error("Datum type mismatch!");
+		}
+
+		if (IsShared())
+		{
+			//Let go of the shared buffer rather than copying elements that are about to be overwritten. The other Datum
+			//keeps it alive, so a range out of it can still be read.
+			Clear();
+		}
+		else if (size_t index = IndexOfElement(first); index < mSize)
+		{
+			//The range is a run of this Datum's elements, destroying them first would leave nothing to copy
+			BeginWrite();
+			T* data = reinterpret_cast<T*>(mData.vp);
+			size_t count = static_cast<size_t>(last - first);
+			if constexpr (std::is_same_v<T, std::string>)
+			{
+				//A string moved onto itself is left unspecified, and a run that already starts at the front needs no move
+				if (index > 0)
+				{
+					std::move(data + index, data + index + count, data);
+				}
+				for (size_t i = count; i < mSize; ++i)
+				{
+					mData.mString[i].std::string::~string();
+				}
+			}
+			else
+			{
+				memmove(data, data + index, count * sizeof(T));
+			}
+			mSize = count;
+			return;
+		}
+		else
+		{
+			BeginWrite();
+			if constexpr (std::is_same_v<T, std::string>)
+			{
+				for (size_t i = 0; i < mSize; ++i)
+				{
+					mData.mString[i].std::string::~string();
+				}
+			}
+			mSize = 0;
+		}
+		PushBackRange(first, last);
+	}
+
+	inline void Datum::CompactTable() const
+	{
+		if (mTombstones != 0)
+		{
+			//Like the cached structural hash, the table is tidied on first read, even through a const reference
+			const_cast<Datum*>(this)->RemoveTombstones();
+		}
+	}
+
+	template <typename T>
+	inline void Datum::CopyRange(T* destination, const T* first, size_t count, bool isConstructed)
+	{
+		if constexpr (std::is_same_v<T, std::string>)
+		{
+			if (isConstructed)
+			{
+				std::copy(first, first + count, destination);
+			}
+			else
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					new (destination + i)std::string(first[i]);
+				}
+			}
+		}
+		else
+		{
+			memcpy(destination, first, count * sizeof(T));
+		}
+	}
+
+	template <typename T>
+	inline size_t Datum::IndexOfElement(const T* value) const
+	{
+		//std::less orders pointers into unrelated arrays, where the built-in comparison is unspecified
+		const T* data = reinterpret_cast<const T*>(mData.vp);
+		if (mSize == 0 || std::less<const T*>()(value, data) || !std::less<const T*>()(value, data + mSize))
+		{
+			return mSize;
+		}
+		return static_cast<size_t>(value - data);
+	}
+}
@@ -0,0 +1,762 @@
+#include "pch.h"
+#include "DatumMath.h"
+#include "Datum.h"
+#include <algorithm>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#define DATUM_MATH_X64
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define DATUM_MATH_AVX2
+#else
+#include <cpuid.h>
+#define DATUM_MATH_AVX2 __attribute__((target("avx2,fma")))
+#endif
+#endif
+
+namespace Library
+{
+	namespace
+	{
+		/// <summary>
+		/// One implementation of every operation, over flat runs of floats. Matrices are column major, as in glm.
+		/// </summary>
+		struct Kernels
+		{
+			void (*Add)(float* lhs, const float* rhs, size_t count);
+			void (*Scale)(float* values, float factor, size_t count);
+			void (*MultiplyAdd)(float* lhs, const float* rhs, float factor, size_t count);
+			void (*Transform)(float* vectors, const float* matrix, size_t vectorCount);
+			float (*Sum)(const float* values, size_t count);
+			float (*Min)(const float* values, size_t count);
+			float (*Max)(const float* values, size_t count);
+			size_t (*FindInteger)(const std::int32_t* values, size_t count, std::int32_t item);
+			size_t (*FindFloat)(const float* values, size_t count, float item);
+			size_t (*FindPointer)(const void* const* values, size_t count, const void* item);
+			size_t (*MismatchPointer)(const void* const* lhs, const void* const* rhs, size_t count);
+		};
+
+#pragma region Scalar
+
+		void AddScalar(float* lhs, const float* rhs, size_t count)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				lhs[i] += rhs[i];
+			}
+		}
+
+		void ScaleScalar(float* values, float factor, size_t count)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				values[i] *= factor;
+			}
+		}
+
+		void MultiplyAddScalar(float* lhs, const float* rhs, float factor, size_t count)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				lhs[i] += rhs[i] * factor;
+			}
+		}
+
+		void TransformScalar(float* vectors, const float* matrix, size_t vectorCount)
+		{
+			for (size_t i = 0; i < vectorCount; ++i)
+			{
+				float* vector = vectors + i * 4;
+				const float x = vector[0], y = vector[1], z = vector[2], w = vector[3];
+				for (size_t row = 0; row < 4; ++row)
+				{
+					vector[row] = matrix[row] * x + matrix[4 + row] * y + matrix[8 + row] * z + matrix[12 + row] * w;
+				}
+			}
+		}
+
+		float SumScalar(const float* values, size_t count)
+		{
+			//Four running sums, in the order of the SSE lanes, lose less precision than one over a long array
+			float sums[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				sums[0] += values[i];
+				sums[1] += values[i + 1];
+				sums[2] += values[i + 2];
+				sums[3] += values[i + 3];
+			}
+			float sum = (sums[0] + sums[2]) + (sums[1] + sums[3]);
+			for (; i < count; ++i)
+			{
+				sum += values[i];
+			}
+			return sum;
+		}
+
+		float MinScalar(const float* values, size_t count)
+		{
+			return *std::min_element(values, values + count);
+		}
+
+		float MaxScalar(const float* values, size_t count)
+		{
+			return *std::max_element(values, values + count);
+		}
+
+		size_t FindIntegerScalar(const std::int32_t* values, size_t count, std::int32_t item)
+		{
+			return static_cast<size_t>(std::find(values, values + count, item) - values);
+		}
+
+		size_t FindFloatScalar(const float* values, size_t count, float item)
+		{
+			return static_cast<size_t>(std::find(values, values + count, item) - values);
+		}
+
+		size_t FindPointerScalar(const void* const* values, size_t count, const void* item)
+		{
+			return static_cast<size_t>(std::find(values, values + count, item) - values);
+		}
+
+		size_t MismatchPointerScalar(const void* const* lhs, const void* const* rhs, size_t count)
+		{
+			return static_cast<size_t>(std::mismatch(lhs, lhs + count, rhs).first - lhs);
+		}
+
+		const Kernels ScalarKernels = { &AddScalar, &ScaleScalar, &MultiplyAddScalar, &TransformScalar, &SumScalar, &MinScalar, &MaxScalar,
+			&FindIntegerScalar, &FindFloatScalar, &FindPointerScalar, &MismatchPointerScalar };
+
+#pragma endregion
+
+#if defined(DATUM_MATH_X64)
+#pragma region SSE
+
+		//SSE2 is part of x64, so these need no detection and serve as the tails of the AVX2 kernels
+
+		void AddSse(float* lhs, const float* rhs, size_t count)
+		{
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				_mm_storeu_ps(lhs + i, _mm_add_ps(_mm_loadu_ps(lhs + i), _mm_loadu_ps(rhs + i)));
+			}
+			AddScalar(lhs + i, rhs + i, count - i);
+		}
+
+		void ScaleSse(float* values, float factor, size_t count)
+		{
+			const __m128 factors = _mm_set1_ps(factor);
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				_mm_storeu_ps(values + i, _mm_mul_ps(_mm_loadu_ps(values + i), factors));
+			}
+			ScaleScalar(values + i, factor, count - i);
+		}
+
+		void MultiplyAddSse(float* lhs, const float* rhs, float factor, size_t count)
+		{
+			const __m128 factors = _mm_set1_ps(factor);
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				_mm_storeu_ps(lhs + i, _mm_add_ps(_mm_loadu_ps(lhs + i), _mm_mul_ps(_mm_loadu_ps(rhs + i), factors)));
+			}
+			MultiplyAddScalar(lhs + i, rhs + i, factor, count - i);
+		}
+
+		void TransformSse(float* vectors, const float* matrix, size_t vectorCount)
+		{
+			const __m128 column0 = _mm_loadu_ps(matrix);
+			const __m128 column1 = _mm_loadu_ps(matrix + 4);
+			const __m128 column2 = _mm_loadu_ps(matrix + 8);
+			const __m128 column3 = _mm_loadu_ps(matrix + 12);
+			for (size_t i = 0; i < vectorCount; ++i)
+			{
+				float* vector = vectors + i * 4;
+				const __m128 v = _mm_loadu_ps(vector);
+				__m128 result = _mm_mul_ps(column0, _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+				result = _mm_add_ps(result, _mm_mul_ps(column1, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))));
+				result = _mm_add_ps(result, _mm_mul_ps(column2, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2))));
+				result = _mm_add_ps(result, _mm_mul_ps(column3, _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))));
+				_mm_storeu_ps(vector, result);
+			}
+		}
+
+		float HorizontalSum(__m128 values)
+		{
+			__m128 sums = _mm_add_ps(values, _mm_movehl_ps(values, values));
+			sums = _mm_add_ss(sums, _mm_shuffle_ps(sums, sums, _MM_SHUFFLE(1, 1, 1, 1)));
+			return _mm_cvtss_f32(sums);
+		}
+
+		float HorizontalMin(__m128 values)
+		{
+			__m128 mins = _mm_min_ps(values, _mm_movehl_ps(values, values));
+			mins = _mm_min_ss(mins, _mm_shuffle_ps(mins, mins, _MM_SHUFFLE(1, 1, 1, 1)));
+			return _mm_cvtss_f32(mins);
+		}
+
+		float HorizontalMax(__m128 values)
+		{
+			__m128 maxes = _mm_max_ps(values, _mm_movehl_ps(values, values));
+			maxes = _mm_max_ss(maxes, _mm_shuffle_ps(maxes, maxes, _MM_SHUFFLE(1, 1, 1, 1)));
+			return _mm_cvtss_f32(maxes);
+		}
+
+		float SumSse(const float* values, size_t count)
+		{
+			__m128 sums = _mm_setzero_ps();
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				sums = _mm_add_ps(sums, _mm_loadu_ps(values + i));
+			}
+			float sum = HorizontalSum(sums);
+			for (; i < count; ++i)
+			{
+				sum += values[i];
+			}
+			return sum;
+		}
+
+		float MinSse(const float* values, size_t count)
+		{
+			if (count < 4)
+			{
+				return MinScalar(values, count);
+			}
+			__m128 mins = _mm_loadu_ps(values);
+			size_t i = 4;
+			for (; i + 4 <= count; i += 4)
+			{
+				mins = _mm_min_ps(mins, _mm_loadu_ps(values + i));
+			}
+			float min = HorizontalMin(mins);
+			return (i < count ? std::min(min, MinScalar(values + i, count - i)) : min);
+		}
+
+		float MaxSse(const float* values, size_t count)
+		{
+			if (count < 4)
+			{
+				return MaxScalar(values, count);
+			}
+			__m128 maxes = _mm_loadu_ps(values);
+			size_t i = 4;
+			for (; i + 4 <= count; i += 4)
+			{
+				maxes = _mm_max_ps(maxes, _mm_loadu_ps(values + i));
+			}
+			float max = HorizontalMax(maxes);
+			return (i < count ? std::max(max, MaxScalar(values + i, count - i)) : max);
+		}
+
+		/// <summary>
+		/// Index of the lowest set bit of a non-zero comparison mask
+		/// </summary>
+		unsigned int FirstSetBit(unsigned int mask)
+		{
+#if defined(_MSC_VER)
+			unsigned long index;
+			_BitScanForward(&index, mask);
+			return static_cast<unsigned int>(index);
+#else
+			return static_cast<unsigned int>(__builtin_ctz(mask));
+#endif
+		}
+
+		size_t FindIntegerSse(const std::int32_t* values, size_t count, std::int32_t item)
+		{
+			const __m128i items = _mm_set1_epi32(item);
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m128i equal = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i)), items);
+				const unsigned int mask = static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(equal)));
+				if (mask != 0)
+				{
+					return i + FirstSetBit(mask);
+				}
+			}
+			return i + FindIntegerScalar(values + i, count - i, item);
+		}
+
+		size_t FindFloatSse(const float* values, size_t count, float item)
+		{
+			const __m128 items = _mm_set1_ps(item);
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				const unsigned int mask = static_cast<unsigned int>(_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(values + i), items)));
+				if (mask != 0)
+				{
+					return i + FirstSetBit(mask);
+				}
+			}
+			return i + FindFloatScalar(values + i, count - i, item);
+		}
+
+		//SSE2 has no 64-bit compare, so pointers are compared as pairs of 32-bit halves that must both match
+
+		size_t FindPointerSse(const void* const* values, size_t count, const void* item)
+		{
+			const __m128i items = _mm_set1_epi64x(static_cast<long long>(reinterpret_cast<std::uintptr_t>(item)));
+			size_t i = 0;
+			for (; i + 2 <= count; i += 2)
+			{
+				const __m128i equal = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i)), items);
+				const unsigned int mask = static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(equal)));
+				const unsigned int pairs = mask & (mask >> 1) & 0x5;
+				if (pairs != 0)
+				{
+					return i + FirstSetBit(pairs) / 2;
+				}
+			}
+			return i + FindPointerScalar(values + i, count - i, item);
+		}
+
+		size_t MismatchPointerSse(const void* const* lhs, const void* const* rhs, size_t count)
+		{
+			size_t i = 0;
+			for (; i + 2 <= count; i += 2)
+			{
+				const __m128i equal = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i)));
+				const unsigned int mask = static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(equal)));
+				if (mask != 0xF)
+				{
+					return i + FirstSetBit(~mask & 0xF) / 2;
+				}
+			}
+			return i + MismatchPointerScalar(lhs + i, rhs + i, count - i);
+		}
+
+		const Kernels SseKernels = { &AddSse, &ScaleSse, &MultiplyAddSse, &TransformSse, &SumSse, &MinSse, &MaxSse,
+			&FindIntegerSse, &FindFloatSse, &FindPointerSse, &MismatchPointerSse };
+
+#pragma endregion
+
+#pragma region AVX2
+
+		DATUM_MATH_AVX2 void AddAvx2(float* lhs, const float* rhs, size_t count)
+		{
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				_mm256_storeu_ps(lhs + i, _mm256_add_ps(_mm256_loadu_ps(lhs + i), _mm256_loadu_ps(rhs + i)));
+			}
+			AddSse(lhs + i, rhs + i, count - i);
+		}
+
+		DATUM_MATH_AVX2 void ScaleAvx2(float* values, float factor, size_t count)
+		{
+			const __m256 factors = _mm256_set1_ps(factor);
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				_mm256_storeu_ps(values + i, _mm256_mul_ps(_mm256_loadu_ps(values + i), factors));
+			}
+			ScaleSse(values + i, factor, count - i);
+		}
+
+		DATUM_MATH_AVX2 void MultiplyAddAvx2(float* lhs, const float* rhs, float factor, size_t count)
+		{
+			const __m256 factors = _mm256_set1_ps(factor);
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				_mm256_storeu_ps(lhs + i, _mm256_fmadd_ps(_mm256_loadu_ps(rhs + i), factors, _mm256_loadu_ps(lhs + i)));
+			}
+			MultiplyAddSse(lhs + i, rhs + i, factor, count - i);
+		}
+
+		DATUM_MATH_AVX2 __m256 BroadcastColumn(const float* column)
+		{
+			const __m128 values = _mm_loadu_ps(column);
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(values), values, 1);
+		}
+
+		DATUM_MATH_AVX2 void TransformAvx2(float* vectors, const float* matrix, size_t vectorCount)
+		{
+			//Two vectors per register, each lane multiplied by the same copy of the matrix
+			const __m256 column0 = BroadcastColumn(matrix);
+			const __m256 column1 = BroadcastColumn(matrix + 4);
+			const __m256 column2 = BroadcastColumn(matrix + 8);
+			const __m256 column3 = BroadcastColumn(matrix + 12);
+			size_t i = 0;
+			for (; i + 2 <= vectorCount; i += 2)
+			{
+				float* pair = vectors + i * 4;
+				const __m256 v = _mm256_loadu_ps(pair);
+				__m256 result = _mm256_mul_ps(column0, _mm256_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)));
+				result = _mm256_fmadd_ps(column1, _mm256_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1)), result);
+				result = _mm256_fmadd_ps(column2, _mm256_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)), result);
+				result = _mm256_fmadd_ps(column3, _mm256_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3)), result);
+				_mm256_storeu_ps(pair, result);
+			}
+			TransformSse(vectors + i * 4, matrix, vectorCount - i);
+		}
+
+		DATUM_MATH_AVX2 float SumAvx2(const float* values, size_t count)
+		{
+			__m256 sums = _mm256_setzero_ps();
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				sums = _mm256_add_ps(sums, _mm256_loadu_ps(values + i));
+			}
+			const __m128 folded = _mm_add_ps(_mm256_castps256_ps128(sums), _mm256_extractf128_ps(sums, 1));
+			return HorizontalSum(folded) + SumSse(values + i, count - i);
+		}
+
+		DATUM_MATH_AVX2 float MinAvx2(const float* values, size_t count)
+		{
+			if (count < 8)
+			{
+				return MinSse(values, count);
+			}
+			__m256 mins = _mm256_loadu_ps(values);
+			size_t i = 8;
+			for (; i + 8 <= count; i += 8)
+			{
+				mins = _mm256_min_ps(mins, _mm256_loadu_ps(values + i));
+			}
+			float min = HorizontalMin(_mm_min_ps(_mm256_castps256_ps128(mins), _mm256_extractf128_ps(mins, 1)));
+			return (i < count ? std::min(min, MinSse(values + i, count - i)) : min);
+		}
+
+		DATUM_MATH_AVX2 float MaxAvx2(const float* values, size_t count)
+		{
+			if (count < 8)
+			{
+				return MaxSse(values, count);
+			}
+			__m256 maxes = _mm256_loadu_ps(values);
+			size_t i = 8;
+			for (; i + 8 <= count; i += 8)
+			{
+				maxes = _mm256_max_ps(maxes, _mm256_loadu_ps(values + i));
+			}
+			float max = HorizontalMax(_mm_max_ps(_mm256_castps256_ps128(maxes), _mm256_extractf128_ps(maxes, 1)));
+			return (i < count ? std::max(max, MaxSse(values + i, count - i)) : max);
+		}
+
+		DATUM_MATH_AVX2 size_t FindIntegerAvx2(const std::int32_t* values, size_t count, std::int32_t item)
+		{
+			const __m256i items = _mm256_set1_epi32(item);
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m256i equal = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i)), items);
+				const unsigned int mask = static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(equal)));
+				if (mask != 0)
+				{
+					return i + FirstSetBit(mask);
+				}
+			}
+			return i + FindIntegerSse(values + i, count - i, item);
+		}
+
+		DATUM_MATH_AVX2 size_t FindFloatAvx2(const float* values, size_t count, float item)
+		{
+			const __m256 items = _mm256_set1_ps(item);
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				const unsigned int mask = static_cast<unsigned int>(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(values + i), items, _CMP_EQ_OQ)));
+				if (mask != 0)
+				{
+					return i + FirstSetBit(mask);
+				}
+			}
+			return i + FindFloatSse(values + i, count - i, item);
+		}
+
+		DATUM_MATH_AVX2 size_t FindPointerAvx2(const void* const* values, size_t count, const void* item)
+		{
+			const __m256i items = _mm256_set1_epi64x(static_cast<long long>(reinterpret_cast<std::uintptr_t>(item)));
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m256i equal = _mm256_cmpeq_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i)), items);
+				const unsigned int mask = static_cast<unsigned int>(_mm256_movemask_pd(_mm256_castsi256_pd(equal)));
+				if (mask != 0)
+				{
+					return i + FirstSetBit(mask);
+				}
+			}
+			return i + FindPointerSse(values + i, count - i, item);
+		}
+
+		DATUM_MATH_AVX2 size_t MismatchPointerAvx2(const void* const* lhs, const void* const* rhs, size_t count)
+		{
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m256i equal = _mm256_cmpeq_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + i)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + i)));
+				const unsigned int mask = static_cast<unsigned int>(_mm256_movemask_pd(_mm256_castsi256_pd(equal)));
+				if (mask != 0xF)
+				{
+					return i + FirstSetBit(~mask & 0xF);
+				}
+			}
+			return i + MismatchPointerSse(lhs + i, rhs + i, count - i);
+		}
+
+		const Kernels Avx2Kernels = { &AddAvx2, &ScaleAvx2, &MultiplyAddAvx2, &TransformAvx2, &SumAvx2, &MinAvx2, &MaxAvx2,
+			&FindIntegerAvx2, &FindFloatAvx2, &FindPointerAvx2, &MismatchPointerAvx2 };
+
+#pragma endregion
+
+		/// <summary>
+		/// Reads XCR0, which tells which register files the operating system saves on a context switch
+		/// </summary>
+		unsigned long long ReadExtendedControlRegister()
+		{
+#if defined(_MSC_VER)
+			return _xgetbv(0);
+#else
+			unsigned int eax, edx;
+			__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+			return (static_cast<unsigned long long>(edx) << 32) | eax;
+#endif
+		}
+
+		DatumMath::InstructionSet Detect()
+		{
+			unsigned int maxLeaf, features, extendedFeatures = 0;
+#if defined(_MSC_VER)
+			int info[4];
+			__cpuid(info, 0);
+			maxLeaf = static_cast<unsigned int>(info[0]);
+			__cpuid(info, 1);
+			features = static_cast<unsigned int>(info[2]);
+			if (maxLeaf >= 7)
+			{
+				__cpuidex(info, 7, 0);
+				extendedFeatures = static_cast<unsigned int>(info[1]);
+			}
+#else
+			unsigned int eax, ebx, ecx, edx;
+			maxLeaf = __get_cpuid_max(0, nullptr);
+			__cpuid(1, eax, ebx, ecx, edx);
+			features = ecx;
+			if (maxLeaf >= 7)
+			{
+				__cpuid_count(7, 0, eax, ebx, ecx, edx);
+				extendedFeatures = ebx;
+			}
+#endif
+			const bool hasFma = (features & (1u << 12)) != 0;
+			const bool hasOsXsave = (features & (1u << 27)) != 0;
+			const bool hasAvx = (features & (1u << 28)) != 0;
+			const bool hasAvx2 = (extendedFeatures & (1u << 5)) != 0;
+			const bool savesAvxState = hasOsXsave && (ReadExtendedControlRegister() & 0x6) == 0x6;
+			return (hasFma && hasAvx && hasAvx2 && savesAvxState ? DatumMath::InstructionSet::AVX2 : DatumMath::InstructionSet::SSE);
+		}
+#else
+		DatumMath::InstructionSet Detect()
+		{
+			return DatumMath::InstructionSet::Scalar;
+		}
+#endif
+
+		const Kernels& KernelsFor(DatumMath::InstructionSet instructionSet)
+		{
+			switch (instructionSet)
+			{
+#if defined(DATUM_MATH_X64)
+			case DatumMath::InstructionSet::AVX2:
+				return Avx2Kernels;
+			case DatumMath::InstructionSet::SSE:
+				return SseKernels;
+#endif
+			default:
+				return ScalarKernels;
+			}
+		}
+
+		/// <summary>
+		/// Detected once, on first use
+		/// </summary>
+		struct Dispatch
+		{
+			DatumMath::InstructionSet Supported = Detect();
+			DatumMath::InstructionSet Active = Supported;
+			const Kernels* Table = &KernelsFor(Active);
+		};
+
+		Dispatch& GetDispatch()
+		{
+			static Dispatch dispatch;
+			return dispatch;
+		}
+
+		size_t ComponentCount(const Datum& datum)
+		{
+			switch (datum.Type())
+			{
+			case Datum::DatumType::FLOAT:
+				return 1;
+			case Datum::DatumType::VECTOR4:
+				return 4;
+			case Datum::DatumType::MATRIX4X4:
+				return 16;
+			default:
+				throw std::runtime_error("DatumMath only operates on float, vector and matrix datums!");
+			}
+		}
+
+		const float* Floats(const Datum& datum)
+		{
+			switch (datum.Type())
+			{
+			case Datum::DatumType::FLOAT:
+				return datum.AsSpan<float_t>().begin();
+			case Datum::DatumType::VECTOR4:
+				return reinterpret_cast<const float*>(datum.AsSpan<glm::vec4>().begin());
+			default:
+				return reinterpret_cast<const float*>(datum.AsSpan<glm::mat4x4>().begin());
+			}
+		}
+
+		void CheckSameShape(const Datum& lhs, const Datum& rhs)
+		{
+			if (lhs.Type() != rhs.Type() || lhs.Size() != rhs.Size())
+			{
+				throw std::runtime_error("Datums must have the same type and size!");
+			}
+		}
+	}
+
+	DatumMath::InstructionSet DatumMath::Supported()
+	{
+		return GetDispatch().Supported;
+	}
+
+	DatumMath::InstructionSet DatumMath::Active()
+	{
+		return GetDispatch().Active;
+	}
+
+	void DatumMath::SetActive(InstructionSet instructionSet)
+	{
+		Dispatch& dispatch = GetDispatch();
+		if (instructionSet > dispatch.Supported)
+		{
+			throw std::runtime_error("Instruction set is not supported on this machine!");
+		}
+		dispatch.Active = instructionSet;
+		dispatch.Table = &KernelsFor(instructionSet);
+	}
+
+	const char* DatumMath::Name(InstructionSet instructionSet)
+	{
+		switch (instructionSet)
+		{
+		case InstructionSet::SSE:
+			return "SSE";
+		case InstructionSet::AVX2:
+			return "AVX2";
+		default:
+			return "Scalar";
+		}
+	}
+
+	float* DatumMath::WritableFloats(Datum& datum)
+	{
+		datum.BeginWrite();
+		return const_cast<float*>(Floats(static_cast<const Datum&>(datum)));
+	}
+
+	void DatumMath::Add(Datum& lhs, const Datum& rhs)
+	{
+		size_t components = ComponentCount(lhs);
+		CheckSameShape(lhs, rhs);
+		//lhs first, its copy-on-write may give it a new buffer even when rhs is the same Datum
+		float* destination = WritableFloats(lhs);
+		GetDispatch().Table->Add(destination, Floats(rhs), lhs.Size() * components);
+	}
+
+	void DatumMath::Scale(Datum& datum, float factor)
+	{
+		size_t components = ComponentCount(datum);
+		GetDispatch().Table->Scale(WritableFloats(datum), factor, datum.Size() * components);
+	}
+
+	void DatumMath::MultiplyAdd(Datum& lhs, const Datum& rhs, float factor)
+	{
+		size_t components = ComponentCount(lhs);
+		CheckSameShape(lhs, rhs);
+		float* destination = WritableFloats(lhs);
+		GetDispatch().Table->MultiplyAdd(destination, Floats(rhs), factor, lhs.Size() * components);
+	}
+
+	void DatumMath::Transform(Datum& vectors, const glm::mat4& matrix)
+	{
+		if (vectors.Type() != Datum::DatumType::VECTOR4)
+		{
+			throw std::runtime_error("Only vector datums can be transformed!");
+		}
+		GetDispatch().Table->Transform(WritableFloats(vectors), &matrix[0][0], vectors.Size());
+	}
+
+	void DatumMath::Multiply(Datum& matrices, const glm::mat4& matrix)
+	{
+		if (matrices.Type() != Datum::DatumType::MATRIX4X4)
+		{
+			throw std::runtime_error("Only matrix datums can be multiplied by a matrix!");
+		}
+		//Each column of matrix * m is matrix times that column of m
+		GetDispatch().Table->Transform(WritableFloats(matrices), &matrix[0][0], matrices.Size() * 4);
+	}
+
+	float DatumMath::Sum(const Datum& datum)
+	{
+		size_t components = ComponentCount(datum);
+		return GetDispatch().Table->Sum(Floats(datum), datum.Size() * components);
+	}
+
+	float DatumMath::Min(const Datum& datum)
+	{
+		size_t components = ComponentCount(datum);
+		if (datum.Size() == 0)
+		{
+			throw std::runtime_error("Cannot reduce an empty datum!");
+		}
+		return GetDispatch().Table->Min(Floats(datum), datum.Size() * components);
+	}
+
+	float DatumMath::Max(const Datum& datum)
+	{
+		size_t components = ComponentCount(datum);
+		if (datum.Size() == 0)
+		{
+			throw std::runtime_error("Cannot reduce an empty datum!");
+		}
+		return GetDispatch().Table->Max(Floats(datum), datum.Size() * components);
+	}
+
+	size_t DatumMath::Find(const std::int32_t* values, size_t count, std::int32_t item)
+	{
+		return GetDispatch().Table->FindInteger(values, count, item);
+	}
+
+	size_t DatumMath::Find(const float* values, size_t count, float item)
+	{
+		return GetDispatch().Table->FindFloat(values, count, item);
+	}
+
+	size_t DatumMath::Find(const void* const* values, size_t count, const void* item)
+	{
+		return GetDispatch().Table->FindPointer(values, count, item);
+	}
+
+	size_t DatumMath::Mismatch(const void* const* lhs, const void* const* rhs, size_t count)
+	{
+		return GetDispatch().Table->MismatchPointer(lhs, rhs, count);
+	}
+}
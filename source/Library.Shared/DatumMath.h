@@ -0,0 +1,165 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <glm/glm.hpp>
+
+namespace Library
+{
+	class Datum;
+
+	/// <summary>
+	/// Arithmetic over whole FLOAT, VECTOR4 and MATRIX4X4 Datums. Each operation runs an SSE or AVX2 kernel, picked at
+	/// startup from the instruction sets the CPU and operating system support, and falls back to scalar code elsewhere.
+	/// Vectors and matrices are processed as flat runs of floats where the operation allows it, so a Datum of one type is
+	/// as fast as any other. Results may differ in the last bit between instruction sets, since the wider kernels fuse
+	/// multiplies and adds and sum in a different order. The same dispatch also serves the searches and comparisons behind
+	/// Datum::Find, Datum::Remove and Datum::operator==.
+	/// </summary>
+	class DatumMath final
+	{
+	public:
+		/// <summary>
+		/// Kernel families, from slowest to fastest
+		/// </summary>
+		enum class InstructionSet
+		{
+			Scalar,
+			SSE,
+			AVX2
+		};
+
+		DatumMath() = delete;
+		DatumMath(const DatumMath& rhs) = delete;
+		DatumMath(DatumMath&& rhs) = delete;
+		DatumMath& operator=(const DatumMath& rhs) = delete;
+		DatumMath& operator=(DatumMath&& rhs) = delete;
+
+		/// <summary>
+		/// Detects the fastest kernels the machine can run. AVX2 also requires FMA and an operating system that saves
+		/// the AVX registers. Only x64 builds use SIMD kernels.
+		/// </summary>
+		/// <returns>Fastest supported instruction set</returns>
+		static InstructionSet Supported();
+
+		/// <summary>
+		/// Provides the kernels in use, Supported() unless SetActive chose otherwise
+		/// </summary>
+		/// <returns>Active instruction set</returns>
+		static InstructionSet Active();
+
+		/// <summary>
+		/// Switches every operation to the given kernels, e.g. to compare them in tests and benchmarks. Not thread safe.
+		/// </summary>
+		/// <param name="instructionSet">Instruction set to use</param>
+		static void SetActive(InstructionSet instructionSet);
+
+		/// <summary>
+		/// Provides the name of an instruction set for reports
+		/// </summary>
+		/// <param name="instructionSet">Instruction set</param>
+		/// <returns>Name of the instruction set</returns>
+		static const char* Name(InstructionSet instructionSet);
+
+		/// <summary>
+		/// Adds every element of rhs to the matching element of lhs
+		/// </summary>
+		/// <param name="lhs">Datum to update</param>
+		/// <param name="rhs">Datum of the same type and size</param>
+		static void Add(Datum& lhs, const Datum& rhs);
+
+		/// <summary>
+		/// Multiplies every element by a factor
+		/// </summary>
+		/// <param name="datum">Datum to update</param>
+		/// <param name="factor">Factor</param>
+		static void Scale(Datum& datum, float factor);
+
+		/// <summary>
+		/// Adds every element of rhs, multiplied by a factor, to the matching element of lhs, e.g. position += velocity * dt
+		/// </summary>
+		/// <param name="lhs">Datum to update</param>
+		/// <param name="rhs">Datum of the same type and size</param>
+		/// <param name="factor">Factor applied to rhs</param>
+		static void MultiplyAdd(Datum& lhs, const Datum& rhs, float factor);
+
+		/// <summary>
+		/// Replaces every vector v of a VECTOR4 Datum with matrix * v
+		/// </summary>
+		/// <param name="vectors">VECTOR4 Datum to update</param>
+		/// <param name="matrix">Transform</param>
+		static void Transform(Datum& vectors, const glm::mat4& matrix);
+
+		/// <summary>
+		/// Replaces every matrix m of a MATRIX4X4 Datum with matrix * m
+		/// </summary>
+		/// <param name="matrices">MATRIX4X4 Datum to update</param>
+		/// <param name="matrix">Matrix to multiply by, on the left</param>
+		static void Multiply(Datum& matrices, const glm::mat4& matrix);
+
+		/// <summary>
+		/// Sums every float of the Datum, each component of a vector or matrix included
+		/// </summary>
+		/// <param name="datum">Datum to reduce</param>
+		/// <returns>Sum, 0 for an empty Datum</returns>
+		static float Sum(const Datum& datum);
+
+		/// <summary>
+		/// Finds the smallest float of the Datum, each component of a vector or matrix included
+		/// </summary>
+		/// <param name="datum">Datum to reduce, must not be empty</param>
+		/// <returns>Smallest value</returns>
+		static float Min(const Datum& datum);
+
+		/// <summary>
+		/// Finds the largest float of the Datum, each component of a vector or matrix included
+		/// </summary>
+		/// <param name="datum">Datum to reduce, must not be empty</param>
+		/// <returns>Largest value</returns>
+		static float Max(const Datum& datum);
+
+		/// <summary>
+		/// Finds the first integer equal to item
+		/// </summary>
+		/// <param name="values">Integers to search</param>
+		/// <param name="count">Number of integers</param>
+		/// <param name="item">Integer to find</param>
+		/// <returns>Index of the integer, count if not found</returns>
+		static size_t Find(const std::int32_t* values, size_t count, std::int32_t item);
+
+		/// <summary>
+		/// Finds the first float equal to item, with the semantics of ==: 0 matches -0 and NaN matches nothing
+		/// </summary>
+		/// <param name="values">Floats to search</param>
+		/// <param name="count">Number of floats</param>
+		/// <param name="item">Float to find</param>
+		/// <returns>Index of the float, count if not found</returns>
+		static size_t Find(const float* values, size_t count, float item);
+
+		/// <summary>
+		/// Finds the first pointer equal to item
+		/// </summary>
+		/// <param name="values">Pointers to search</param>
+		/// <param name="count">Number of pointers</param>
+		/// <param name="item">Pointer to find</param>
+		/// <returns>Index of the pointer, count if not found</returns>
+		static size_t Find(const void* const* values, size_t count, const void* item);
+
+		/// <summary>
+		/// Finds the first position at which two arrays of pointers differ
+		/// </summary>
+		/// <param name="lhs">First array</param>
+		/// <param name="rhs">Second array</param>
+		/// <param name="count">Number of pointers in each array</param>
+		/// <returns>Index of the first difference, count if the arrays are equal</returns>
+		static size_t Mismatch(const void* const* lhs, const void* const* rhs, size_t count);
+
+	private:
+		/// <summary>
+		/// Provides the floats of a FLOAT, VECTOR4 or MATRIX4X4 Datum for one operation. The write ends when the operation
+		/// returns, so unlike Datum::AsSpan this does not make the Datum volatile to its scope's structural hash.
+		/// </summary>
+		/// <param name="datum">Datum to write to</param>
+		/// <returns>Pointer to the first float</returns>
+		static float* WritableFloats(Datum& datum);
+	};
+}
@@ -0,0 +1,118 @@
+#pragma once
+#include "Datum.h"
+
+namespace Library
+{
+	/// <summary>
+	/// Typed view of a Datum whose element type is known at compile time, e.g. an attribute an Action reads every frame.
+	/// The type is checked once, when the view is created; after that Get, Set, PushBack and iteration are inline and do
+	/// no type or bounds checks. Reads cost the same as indexing an array. Writes still copy a shared buffer and mark the
+	/// owning scope's structural hash stale, so they are only as cheap as that allows. T is int32_t, float_t, glm::vec4,
+	/// glm::mat4x4, std::string or RTTI*. Nested scopes are not supported, since they must be adopted through their Scope.
+	/// The view holds only a pointer to the Datum and stays valid as long as the Datum does, even if it grows.
+	/// </summary>
+	template <typename T>
+	class DatumRef final
+	{
+	public:
+		using value_type = T;
+
+		/// <summary>
+		/// Constructor, gives an untyped Datum the type T
+		/// </summary>
+		/// <param name="datum">Datum to view, must hold T or have no type yet</param>
+		explicit DatumRef(Datum& datum);
+
+		/// <summary>
+		/// Provides the viewed Datum
+		/// </summary>
+		/// <returns>Reference to the Datum</returns>
+		Datum& GetDatum() const;
+
+		/// <summary>
+		/// Provides number of elements
+		/// </summary>
+		/// <returns>Size of the Datum</returns>
+		size_t Size() const;
+
+		/// <summary>
+		/// Checks whether the Datum is empty
+		/// </summary>
+		/// <returns>True if the Datum has no elements</returns>
+		bool IsEmpty() const;
+
+		/// <summary>
+		/// Reads an element, the index is only checked by an assert
+		/// </summary>
+		/// <param name="index">Index of the element</param>
+		/// <returns>Const reference to the element</returns>
+		const T& Get(size_t index = 0) const;
+
+		/// <summary>
+		/// Provides an element for writing, the index is only checked by an assert. Like Datum::Get, handing out a
+		/// reference makes the owning scope rehash the Datum on every StructuralHash; Set does not.
+		/// </summary>
+		/// <param name="index">Index of the element</param>
+		/// <returns>Reference to the element</returns>
+		T& operator[](size_t index);
+
+		/// <summary>
+		/// Assigns an element, the index is only checked by an assert
+		/// </summary>
+		/// <param name="value">Value to assign</param>
+		/// <param name="index">Index of the element</param>
+		void Set(const T& value, size_t index = 0);
+
+		/// <summary>
+		/// Appends an element, growing the Datum through Datum::PushBack only when it is full
+		/// </summary>
+		/// <param name="value">Value to append</param>
+		void PushBack(const T& value);
+
+		/// <summary>
+		/// Pointer to the first element, for reading in range-based for loops
+		/// </summary>
+		/// <returns>Pointer to the first element</returns>
+		const T* begin() const;
+
+		/// <summary>
+		/// Pointer past the last element, for reading in range-based for loops
+		/// </summary>
+		/// <returns>Pointer past the last element</returns>
+		const T* end() const;
+
+		/// <summary>
+		/// Pointer to the first element, for writing in range-based for loops. The pointers are invalidated by anything
+		/// that grows or shrinks the Datum.
+		/// </summary>
+		/// <returns>Pointer to the first element</returns>
+		T* begin();
+
+		/// <summary>
+		/// Pointer past the last element, for writing in range-based for loops
+		/// </summary>
+		/// <returns>Pointer past the last element</returns>
+		T* end();
+
+	private:
+		/// <summary>
+		/// Pointer to the current buffer, read through the Datum each time so the view survives reallocation
+		/// </summary>
+		/// <returns>Pointer to the first element</returns>
+		T* Data() const;
+
+		/// <summary>
+		/// Copies a shared buffer and marks the owning scope's structural hash stale, skipping the call when neither applies
+		/// </summary>
+		void BeginWrite();
+
+		/// <summary>
+		/// Begins a write through a reference or pointer that outlives the call, see Datum::BeginMutableView
+		/// </summary>
+		void BeginMutableView();
+
+		Datum* mDatum;
+	};
+}
+
+#include "DatumRef.inl"
@@ -0,0 +1,123 @@
+#include "DatumRef.h"
+#include <cassert>
+#include <new>
+
+namespace Library
+{
+	template <typename T>
+	inline DatumRef<T>::DatumRef(Datum& datum) : mDatum(&datum)
+	{
+		if (datum.mType == Datum::DatumType::UNKNOWN)
+		{
+			datum.SetType(Datum::TypeOf<T>::Value);
+		}
+		else if (datum.mType != Datum::TypeOf<T>::Value)
+		{
+			throw std::runtime_error("Type mismatch!");
+		}
+	}
+
+	template <typename T>
+	inline Datum& DatumRef<T>::GetDatum() const
+	{
+		return *mDatum;
+	}
+
+	template <typename T>
+	inline size_t DatumRef<T>::Size() const
+	{
+		return mDatum->mSize;
+	}
+
+	template <typename T>
+	inline bool DatumRef<T>::IsEmpty() const
+	{
+		return mDatum->mSize == 0;
+	}
+
+	template <typename T>
+	inline const T& DatumRef<T>::Get(size_t index) const
+	{
+		assert(index < mDatum->mSize);
+		return Data()[index];
+	}
+
+	template <typename T>
+	inline T& DatumRef<T>::operator[](size_t index)
+	{
+		assert(index < mDatum->mSize);
+		BeginMutableView();
+		return Data()[index];
+	}
+
+	template <typename T>
+	inline void DatumRef<T>::Set(const T& value, size_t index)
+	{
+		assert(index < mDatum->mSize);
+		BeginWrite();
+		Data()[index] = value;
+	}
+
+	template <typename T>
+	inline void DatumRef<T>::PushBack(const T& value)
+	{
+		Datum& datum = *mDatum;
+		if (datum.mSize == datum.mCapacity || datum.mIsExternal)
+		{
+			//Growth and the external storage error stay in one place
+			datum.PushBack(value);
+			return;
+		}
+		BeginWrite();
+		new (Data() + datum.mSize)T(value);
+		++datum.mSize;
+	}
+
+	template <typename T>
+	inline const T* DatumRef<T>::begin() const
+	{
+		return Data();
+	}
+
+	template <typename T>
+	inline const T* DatumRef<T>::end() const
+	{
+		return Data() + mDatum->mSize;
+	}
+
+	template <typename T>
+	inline T* DatumRef<T>::begin()
+	{
+		BeginMutableView();
+		return Data();
+	}
+
+	template <typename T>
+	inline T* DatumRef<T>::end()
+	{
+		BeginMutableView();
+		return Data() + mDatum->mSize;
+	}
+
+	template <typename T>
+	inline T* DatumRef<T>::Data() const
+	{
+		return reinterpret_cast<T*>(mDatum->mData.vp);
+	}
+
+	template <typename T>
+	inline void DatumRef<T>::BeginWrite()
+	{
+		if (mDatum->mShareCount != nullptr || mDatum->mOwner != nullptr)
+		{
+			mDatum->BeginWrite();
+		}
+	}
+
+	template <typename T>
+	inline void DatumRef<T>::BeginMutableView()
+	{
+		mDatum->mHasMutableViews = true;
+		BeginWrite();
+	}
+}
@@ -2,6 +2,7 @@
 #include "Entity.h"
 #include "Sector.h"
 #include "Action.h"
+#include "PrototypeRegistry.h"
 
 namespace Library
 {
@@ -65,24 +66,29 @@ namespace Library
 	{
 		return Vector<Signature>
 		{
-			{"Name", Datum::DatumType::STRING, 1, offsetof(Entity, mEntityName)},
-			{ "Actions", Datum::DatumType::TABLE, 0, 0 }
+			PRESCRIBED_ATTRIBUTE(Entity, "Name", mEntityName),
+			MakeTableSignature("Actions")
 		};
 	}
 
 	Datum& Entity::Actions()
 	{
-		return (*this)["Actions"];
+		return PrescribedAttribute(ActionsIndex);
 	}
 
 	Action* Entity::CreateAction(const std::string& className, const std::string& instanceName)
 	{
-		Scope* scope = Factory<Scope>::Create(className);
+		const Scope* prototype = PrototypeRegistry::Find(className);
+		Scope* scope = (prototype != nullptr) ? prototype->CloneShared() : Factory<Scope>::Create(className);
 
 		if (scope != nullptr)
 		{
-			assert(scope->Is(Action::TypeIdClass()));
-			Action* action = static_cast<Action*>(scope);
+			Action* action = scope->As<Action>();
+			if (action == nullptr)
+			{
+				delete scope;
+				throw std::runtime_error("The class name does not create an Action!");
+			}
 			action->SetName(instanceName);
 			action->SetEntity(this);
 			return action;
@@ -90,7 +96,7 @@ namespace Library
 		return nullptr;
 	}
 
-	Action* Entity::FindAction(const std::string& actionName)
+	Action* Entity::FindAction(std::string_view actionName)
 	{
 		Action* action = nullptr;
 		auto& actions = Actions();
@@ -106,7 +112,7 @@ namespace Library
 		return action;
 	}
 
-	const Action* Entity::FindAction(const std::string& actionName) const
+	const Action* Entity::FindAction(std::string_view actionName) const
 	{
 		return const_cast<Entity*>(this)->FindAction(actionName);
 	}
@@ -18,6 +18,10 @@ namespace Library
 		RTTI_DECLARATIONS(Entity, Attributed)
 
 	public:
+		static constexpr size_t NameIndex = Attributed::PrescribedSlotCount;
+		static constexpr size_t ActionsIndex = NameIndex + 1;
+		static constexpr size_t PrescribedSlotCount = ActionsIndex + 1;
+
 		/// <summary>Constructor for Entity</summary>
 		Entity();
 
@@ -82,6 +86,7 @@ namespace Library
 
 		/// <summary>
 		/// Takes a class name and instance name to instantiate a new Action object and adopt it into the Actions datum.
+		/// A prototype registered under the class name is cloned in preference to the factory.
 		/// </summary>
 		/// <param name="className">Name of class</param>
 		/// <param name="instanceName">Name of instance</param>
@@ -93,14 +98,14 @@ namespace Library
 		/// </summary>
 		/// <param name="actionName">Name of action to be found</param>
 		/// <returns>Pointer to Action, nullptr if no action is found</returns>
-		Action* FindAction(const std::string& actionName);
+		Action* FindAction(std::string_view actionName);
 
 		/// <summary>
 		/// Finds an action belonging to the entity (const version)
 		/// </summary>
 		/// <param name="actionName">Name of action to be found</param>
 		/// <returns>Pointer to Action, nullptr if no action is found</returns>
-		const Action* FindAction(const std::string& actionName) const;
+		const Action* FindAction(std::string_view actionName) const;
 
 	private:
 		std::string mEntityName;
@@ -9,7 +9,7 @@ namespace Library
 
 	Vector<Signature> EventMessageAttributed::Signatures()
 	{
-		return {{ SubtypeKey, Datum::DatumType::STRING, 1, offsetof(EventMessageAttributed, mSubtype) }};
+		return { PRESCRIBED_ATTRIBUTE(EventMessageAttributed, SubtypeKey, mSubtype) };
 	}
 
 	EventMessageAttributed::EventMessageAttributed() : Attributed(EventMessageAttributed::TypeIdClass())
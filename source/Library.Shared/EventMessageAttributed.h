@@ -21,6 +21,9 @@ namespace Library
 		
 		static const std::string SubtypeKey;
 
+		static constexpr size_t SubtypeIndex = Attributed::PrescribedSlotCount;
+		static constexpr size_t PrescribedSlotCount = SubtypeIndex + 1;
+
 		/// <summary>
 		/// Signatures to be passed to TypeRegistry
 		/// </summary>
@@ -1,9 +1,13 @@
 #pragma once
-#include "HashMap.h"
+#include "FlatHashMap.h"
 
 namespace Library
 {
-	template <typename AbstractProductType>
+	/// <summary>
+	/// Abstract factory of AbstractProductType, keeping every concrete factory in a table keyed by class name. TableType
+	/// is any map with the HashMap interface, FlatHashMap by default; each table type keeps its own registry.
+	/// </summary>
+	template <typename AbstractProductType, template <typename...> class TableType = FlatHashMap>
 	class Factory
 	{
 	public:
@@ -73,7 +77,7 @@ namespace Library
 		static void Remove(Factory& factory);
 
 	private:
-		static HashMap<std::string, Factory<AbstractProductType>*> mFactoriesTable;
+		static TableType<std::string, Factory*> mFactoriesTable;
 	};
 
 #define CONCRETE_FACTORY(ConcreteProductType, AbstractProductType)												\
@@ -4,11 +4,11 @@
 
 namespace Library
 {
-	template <typename AbstractProductType>
-	HashMap<std::string, Factory<AbstractProductType>*> Factory<AbstractProductType>::mFactoriesTable(11);
+	template <typename AbstractProductType, template <typename...> class TableType>
+	TableType<std::string, Factory<AbstractProductType, TableType>*> Factory<AbstractProductType, TableType>::mFactoriesTable(16);
 
-	template<typename AbstractProductType>
-	inline Factory<AbstractProductType>* Factory<AbstractProductType>::Find(const std::string& name)
+	template <typename AbstractProductType, template <typename...> class TableType>
+	inline Factory<AbstractProductType, TableType>* Factory<AbstractProductType, TableType>::Find(const std::string& name)
 	{
 		auto iter = mFactoriesTable.Find(name);
 		if (iter == mFactoriesTable.end())
@@ -18,26 +18,26 @@ namespace Library
 		return (*iter).second;
 	}
 
-	template<typename AbstractProductType>
-	inline gsl::owner<AbstractProductType*> Factory<AbstractProductType>::Create(const std::string& name)
+	template <typename AbstractProductType, template <typename...> class TableType>
+	inline gsl::owner<AbstractProductType*> Factory<AbstractProductType, TableType>::Create(const std::string& name)
 	{
 		return mFactoriesTable.At(name)->Create();
 	}
 
-	template<typename AbstractProductType>
-	inline void Factory<AbstractProductType>::Add(Factory& factory)
+	template <typename AbstractProductType, template <typename...> class TableType>
+	inline void Factory<AbstractProductType, TableType>::Add(Factory& factory)
 	{
 		mFactoriesTable.Insert(std::make_pair(factory.ClassName(), &factory));
 	}
 
-	template<typename AbstractProductType>
-	inline void Factory<AbstractProductType>::Remove(Factory& factory)
+	template <typename AbstractProductType, template <typename...> class TableType>
+	inline void Factory<AbstractProductType, TableType>::Remove(Factory& factory)
 	{
 		mFactoriesTable.Remove(factory.ClassName());
 	}
 
-	template<typename AbstractProductType>
-	inline size_t Factory<AbstractProductType>::GetFactoryTableSize()
+	template <typename AbstractProductType, template <typename...> class TableType>
+	inline size_t Factory<AbstractProductType, TableType>::GetFactoryTableSize()
 	{
 		return mFactoriesTable.Size();
 	}
@@ -0,0 +1,515 @@
+#pragma once
+#include "Vector.h"
+#include "HashFunctions.h"
+#include <initializer_list>
+
+namespace Library
+{
+	template <typename TKey, typename TData, typename HashFunctor = HashFunctions<TKey>>
+
+	/// <summary>
+	/// Open-addressing hashmap with the same interface as HashMap.
+	/// Lookups probe a single contiguous array of (hash, entry) slots using Robin Hood ordering,
+	/// so a miss never touches an entry and a hit dereferences exactly one.
+	/// Entries are stored in pages that are never reallocated, which keeps references to stored
+	/// pairs valid across inserts and rehashes (Scope relies on this for its pointers vector).
+	/// </summary>
+	class FlatHashMap final
+	{
+
+	public:
+		using PairType = std::pair<TKey, TData>;
+
+	private:
+
+		/// <summary>
+		/// Storage for a single pair inside an entry page
+		/// </summary>
+		struct Node final
+		{
+			PairType& Pair();
+			const PairType& Pair() const;
+
+			alignas(PairType) unsigned char Storage[sizeof(PairType)];
+			bool IsOccupied = false;
+		};
+
+		/// <summary>
+		/// Probe slot -- full hash of the key plus the entry it refers to (nullptr when empty)
+		/// </summary>
+		struct Slot final
+		{
+			size_t Hash = 0;
+			Node* Entry = nullptr;
+		};
+
+	public:
+
+		/// <summary>
+		/// Iterator for flat hashmap, visits entries in page order
+		/// </summary>
+		class Iterator final
+		{
+			friend FlatHashMap;
+			friend class ConstIterator;
+
+		public:
+
+			/// <summary>
+			/// Default constructor
+			/// </summary>
+			Iterator() = default;
+
+			/// <summary>
+			/// Default copy constructor
+			/// </summary>
+			/// <param name="rhs">Const reference to copied iterator</param>
+			Iterator(const Iterator& rhs) = default;
+
+			/// <summary>
+			/// Default move constructor
+			/// </summary>
+			/// <param name="rhs">R-value reference to iterator which will be moved.</param>
+			Iterator(Iterator&& rhs) = default;
+
+			/// <summary>
+			/// Default copy assignment operator.
+			/// </summary>
+			/// <param name="rhs">Const reference to passed Iterator.</param>
+			/// <returns>Reference to an Iterator.</returns>
+			Iterator& operator=(const Iterator& rhs) = default;
+
+			/// <summary>
+			/// Default move assignment operator
+			/// </summary>
+			/// <param name="rhs">R-value reference to iterator that is being moved.</param>
+			/// <returns>Reference to an Iterator.</returns>
+			Iterator& operator=(Iterator&& rhs) = default;
+
+			/// <summary>
+			/// Default destructor
+			/// </summary>
+			~Iterator() = default;
+
+			/// <summary>
+			/// Prefix Increment operator
+			/// </summary>
+			/// <returns>Reference to an Iterator.</returns>
+			Iterator& operator++();
+
+			/// <summary>
+			/// Postfix Increment operator
+			/// </summary>
+			/// <returns>Iterator before increment operation.</returns>
+			Iterator operator++(int);
+
+			/// <summary>
+			/// Dereference operator
+			/// </summary>
+			/// <returns>Reference to key/value PairType pointed to by current Iterator.</returns>
+			PairType& operator*() const;
+
+			/// <summary>
+			/// Dereference operator
+			/// </summary>
+			/// <returns>Pointer to key/value PairType pointed to by current Iterator.</returns>
+			PairType* operator->() const;
+
+			/// <summary>
+			/// Comparison operator
+			/// </summary>
+			/// <param name="rhs">Const reference to passed Iterator.</param>
+			/// <returns>Boolean value indicating whether two iterators are equal or not.</returns>
+			bool operator==(const Iterator& rhs) const;
+
+			/// <summary>
+			/// Not equal operator
+			/// </summary>
+			/// <param name="rhs">Const reference to passed Iterator</param>
+			/// <returns>Boolean value indicating whether two iterators aren't equal or not.</returns>
+			bool operator!=(const Iterator& rhs) const;
+
+		private:
+			Iterator(FlatHashMap& owner, Node* node, size_t page = UNKNOWN_PAGE);
+			Node* mNode = nullptr;
+			size_t mPage = UNKNOWN_PAGE;
+			FlatHashMap* mOwner = nullptr;
+		};
+
+		/// <summary>
+		/// ConstIterator for flat hashmap
+		/// </summary>
+		class ConstIterator final
+		{
+			friend FlatHashMap;
+			friend class Iterator;
+
+		public:
+
+			/// <summary>
+			/// Copy constructor for converting Iterator to ConstIterator
+			/// </summary>
+			/// <param name="rhs">Const reference to iterator that is to be copied</param>
+			ConstIterator(const Iterator& rhs);
+
+			/// <summary>
+			/// Default constructor
+			/// </summary>
+			ConstIterator() = default;
+
+			/// <summary>
+			/// Default copy constructor
+			/// </summary>
+			/// <param name="rhs">Const reference to copied ConstIterator</param>
+			ConstIterator(const ConstIterator& rhs) = default;
+
+			/// <summary>
+			/// Default move constructor
+			/// </summary>
+			/// <param name="rhs">R-value reference to ConstIterator which will be moved.</param>
+			ConstIterator(ConstIterator&& rhs) = default;
+
+			/// <summary>
+			/// Default copy assignment operator.
+			/// </summary>
+			/// <param name="rhs">Const reference to passed ConstIterator.</param>
+			/// <returns>Reference to an ConstIterator.</returns>
+			ConstIterator& operator=(const ConstIterator& rhs) = default;
+
+			/// <summary>
+			/// Default move assignment operator
+			/// </summary>
+			/// <param name="rhs">R-value reference to ConstIterator that is being moved.</param>
+			/// <returns>Reference to an ConstIterator.</returns>
+			ConstIterator& operator=(ConstIterator&& rhs) = default;
+
+			/// <summary>
+			/// Default destructor
+			/// </summary>
+			~ConstIterator() = default;
+
+			/// <summary>
+			/// Prefix Increment operator
+			/// </summary>
+			/// <returns>Reference to an ConstIterator.</returns>
+			ConstIterator& operator++();
+
+			/// <summary>
+			/// Postfix Increment operator
+			/// </summary>
+			/// <returns>ConstIterator before increment operation.</returns>
+			ConstIterator operator++(int);
+
+			/// <summary>
+			/// Dereference operator
+			/// </summary>
+			/// <returns>Reference to key/value PairType pointed to by current ConstIterator.</returns>
+			const PairType& operator*() const;
+
+			/// <summary>
+			/// Dereference operator
+			/// </summary>
+			/// <returns>Pointer to key/value PairType pointed to by current ConstIterator.</returns>
+			const PairType* operator->() const;
+
+			/// <summary>
+			/// Comparison operator
+			/// </summary>
+			/// <param name="rhs">Const reference to passed ConstIterator.</param>
+			/// <returns>Boolean value indicating whether two iterators are equal or not.</returns>
+			bool operator==(const ConstIterator& rhs) const;
+
+			/// <summary>
+			/// Not equal operator
+			/// </summary>
+			/// <param name="rhs">Const reference to passed ConstIterator</param>
+			/// <returns>Boolean value indicating whether two iterators aren't equal or not.</returns>
+			bool operator!=(const ConstIterator& rhs) const;
+
+		private:
+			ConstIterator(const FlatHashMap& owner, const Node* node, size_t page = UNKNOWN_PAGE);
+			const Node* mNode = nullptr;
+			size_t mPage = UNKNOWN_PAGE;
+			const FlatHashMap* mOwner = nullptr;
+		};
+
+		/// <summary>
+		/// Parameterized constructor
+		/// </summary>
+		/// <param name="numberOfBuckets">Minimum number of probe slots (rounded up to a power of two)</param>
+		explicit FlatHashMap(size_t numberOfBuckets = DEFAULT_NUM_BUCKETS);
+
+		/// <summary>
+		/// Constructor that allocates slots and entry pages from the provided resource instead of the default one
+		/// </summary>
+		/// <param name="resource">Resource the slots and pages are allocated from</param>
+		/// <param name="numberOfBuckets">Minimum number of probe slots (rounded up to a power of two)</param>
+		explicit FlatHashMap(MemoryResource& resource, size_t numberOfBuckets = DEFAULT_NUM_BUCKETS);
+
+		/// <summary>
+		/// Initializer list constructor
+		/// </summary>
+		/// <param name="list">Initializer arguments</param>
+		FlatHashMap(std::initializer_list<PairType> list);
+
+		/// <summary>
+		/// Copy constructor, the copy allocates from the default resource
+		/// </summary>
+		/// <param name="rhs">Const reference of hashmap to be copied</param>
+		FlatHashMap(const FlatHashMap& rhs);
+
+		/// <summary>
+		/// Move constructor
+		/// </summary>
+		/// <param name="rhs">R value reference of hashmap to be moved</param>
+		FlatHashMap(FlatHashMap&& rhs);
+
+		/// <summary>
+		/// Copy assignment operator
+		/// </summary>
+		/// <param name="rhs">Const reference of hashmap to be copied</param>
+		/// <returns>Reference of hashmap</returns>
+		FlatHashMap& operator=(const FlatHashMap& rhs);
+
+		/// <summary>
+		/// Move assignment operator
+		/// </summary>
+		/// <param name="rhs">R value reference of hashmap to be moved</param>
+		/// <returns>Reference of hashmap</returns>
+		FlatHashMap& operator=(FlatHashMap&& rhs);
+
+		/// <summary>
+		/// Destructor, destroys every pair and releases slots and pages
+		/// </summary>
+		~FlatHashMap();
+
+		/// <summary>
+		/// Finds whether a given key exists in the hashmap
+		/// </summary>
+		/// <param name="key">Const reference to a key</param>
+		/// <returns>Iterator to an element found or iterator to the end</returns>
+		Iterator Find(const TKey& key);
+
+		/// <summary>
+		/// Const version of Find
+		/// </summary>
+		/// <param name="key">Const reference to a key</param>
+		/// <returns>ConstIterator to an element or to the end</returns>
+		ConstIterator Find(const TKey& key) const;
+
+		/// <summary>
+		/// Heterogeneous Find: searches with a key of another type (e.g. std::string_view or const char* for std::string keys)
+		/// without constructing a TKey. Only available when the hash functor declares is_transparent.
+		/// </summary>
+		/// <param name="key">Key comparable with TKey and hashable by HashFunctor</param>
+		/// <returns>Iterator to an element found or iterator to the end</returns>
+		template <typename TLookup, typename Functor = HashFunctor, typename = typename Functor::is_transparent>
+		Iterator Find(const TLookup& key);
+
+		/// <summary>
+		/// Const version of heterogeneous Find
+		/// </summary>
+		/// <param name="key">Key comparable with TKey and hashable by HashFunctor</param>
+		/// <returns>ConstIterator to an element or to the end</returns>
+		template <typename TLookup, typename Functor = HashFunctor, typename = typename Functor::is_transparent>
+		ConstIterator Find(const TLookup& key) const;
+
+		/// <summary>
+		/// Inserts element into the hashmap, growing the slot array when the maximum load factor would be exceeded
+		/// </summary>
+		/// <param name="pair">Const reference to a pair type</param>
+		/// <returns>Iterator to inserted element, or iterator to existing element</returns>
+		Iterator Insert(const PairType& pair);
+		Iterator Insert(const PairType& pair, bool& result);
+
+		/// <summary>
+		/// Inserts element using a hash the caller already computed, which must equal HashFunctor applied to the key
+		/// </summary>
+		/// <param name="pair">Const reference to a pair type</param>
+		/// <param name="hash">Precomputed hash of the key</param>
+		/// <param name="result">Set to true if the element was inserted</param>
+		/// <returns>Iterator to inserted element, or iterator to existing element</returns>
+		Iterator Insert(const PairType& pair, size_t hash, bool& result);
+
+		/// <summary>
+		/// Index operator
+		/// </summary>
+		/// <param name="key">Const reference to a key</param>
+		/// <returns>Reference to data</returns>
+		TData& operator[](const TKey& key);
+
+		/// <summary>
+		/// Removes element from hashmap
+		/// </summary>
+		/// <param name="key">Key</param>
+		void Remove(const TKey& key);
+
+		/// <summary>
+		/// Empties table, releases entry pages but keeps the slot array
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Rebuilds the slot array -- stored pairs are not moved or copied
+		/// </summary>
+		/// <param name="numberOfBuckets">Minimum number of probe slots (rounded up to a power of two)</param>
+		void Rehash(size_t numberOfBuckets);
+
+		/// <summary>
+		/// Shrinks the slot array to the fewest slots the population fits in and trims the bookkeeping vectors. Entry
+		/// pages stay, since pairs never move.
+		/// </summary>
+		void ShrinkToFit();
+
+		/// <summary>
+		/// Reports the bytes of the slots, the entry pages and the bookkeeping vectors. Heap owned by the keys and values is not followed.
+		/// </summary>
+		/// <returns>Used and slack bytes by category</returns>
+		MemoryFootprint Footprint() const;
+
+		/// <summary>
+		/// Returns population of the table
+		/// </summary>
+		/// <returns>Population (size) of the table</returns>
+		size_t Size() const;
+
+		/// <summary>
+		/// Provides ratio of occupied slots to total slots
+		/// </summary>
+		/// <returns>Load factor (aforementioned ratio)</returns>
+		float_t LoadFactor() const;
+
+		/// <summary>
+		/// Provides total number of probe slots in the hashmap
+		/// </summary>
+		/// <returns>Total number of slots</returns>
+		size_t NumberOfBuckets() const;
+
+		/// <summary>
+		/// Determines if key is in hash map
+		/// </summary>
+		/// <param name="key">Key to be "found"</param>
+		/// <returns>True if key is in hash map, false if not</returns>
+		bool ContainsKey(const TKey& key);
+
+		/// <summary>
+		/// Determines if key is in hash map
+		/// </summary>
+		/// <param name="key">Key to be "found"</param>
+		/// <param name="iter">Iterator pointing to found item (or end, if item is not found)</param>
+		/// <returns>True if key is in hash map, false if not</returns>
+		bool ContainsKey(const TKey& key, Iterator& iter);
+
+		/// <summary>
+		/// Returns a TData reference for the provided key
+		/// </summary>
+		/// <param name="key">Const TKey Reference</param>
+		/// <returns>TData reference</returns>
+		TData& At(const TKey& key);
+
+		/// <summary>
+		/// Const version of At
+		/// </summary>
+		/// <param name="key">Const TKey reference</param>
+		/// <returns>Const TData Reference</returns>
+		const TData& At(const TKey& key) const;
+
+		/// <summary>
+		/// Heterogeneous ContainsKey, see heterogeneous Find
+		/// </summary>
+		/// <param name="key">Key comparable with TKey and hashable by HashFunctor</param>
+		/// <returns>True if key is in hash map, false if not</returns>
+		template <typename TLookup, typename Functor = HashFunctor, typename = typename Functor::is_transparent>
+		bool ContainsKey(const TLookup& key);
+
+		/// <summary>
+		/// Heterogeneous At, see heterogeneous Find
+		/// </summary>
+		/// <param name="key">Key comparable with TKey and hashable by HashFunctor</param>
+		/// <returns>TData reference</returns>
+		template <typename TLookup, typename Functor = HashFunctor, typename = typename Functor::is_transparent>
+		TData& At(const TLookup& key);
+
+		/// <summary>
+		/// Const version of heterogeneous At
+		/// </summary>
+		/// <param name="key">Key comparable with TKey and hashable by HashFunctor</param>
+		/// <returns>Const TData Reference</returns>
+		template <typename TLookup, typename Functor = HashFunctor, typename = typename Functor::is_transparent>
+		const TData& At(const TLookup& key) const;
+
+		/// <summary>
+		/// Provides iterator to first element in hashmap
+		/// </summary>
+		/// <returns>Iterator to first element in hashmap</returns>
+		Iterator begin();
+
+		/// <summary>
+		/// Const version of begin
+		/// </summary>
+		/// <returns>ConstIterator to first element in hashmap</returns>
+		ConstIterator begin() const;
+
+		/// <summary>
+		/// Provides iterator pointing to end of hashmap
+		/// </summary>
+		/// <returns>Iterator to the end of the hashmap</returns>
+		Iterator end();
+
+		/// <summary>
+		/// Const version of end
+		/// </summary>
+		/// <returns>ConstIterator to the end of the hashmap</returns>
+		ConstIterator end() const;
+
+		/// <summary>
+		/// Provides ConstIterator of the first element in the hashmap
+		/// </summary>
+		/// <returns>ConstIterator of the first element in the hashmap</returns>
+		ConstIterator cbegin() const;
+
+		/// <summary>
+		/// Provides ConstIterator to the end of the hashmap
+		/// </summary>
+		/// <returns>ConstIterator to the end of the hashmap</returns>
+		ConstIterator cend() const;
+
+		/// <summary>
+		/// Provides the resource the slots and entry pages are allocated from
+		/// </summary>
+		/// <returns>Reference to the memory resource</returns>
+		MemoryResource& Resource() const;
+
+	private:
+		template <typename TLookup>
+		size_t FindSlot(const TLookup& key, size_t hash) const;
+		size_t HomeSlot(size_t hash) const;
+		size_t ProbeDistance(size_t hash, size_t index) const;
+		void PlaceSlot(Slot slot);
+		void ResizeSlots(size_t numberOfSlots);
+		Node* AllocateNode();
+		void ReleasePages();
+		size_t PageCapacity(size_t page) const;
+		size_t PageOf(const Node* node) const;
+		const Node* FirstOccupied(size_t& page, size_t offset) const;
+		static size_t RoundUpToPowerOfTwo(size_t value);
+
+		MemoryResource* mResource;
+		Slot* mSlots = nullptr;
+		size_t mSlotCount = 0;
+		size_t mShift = 0;
+		size_t mSize = 0;
+		Vector<Node*> mPages;
+		size_t mLastPageUsed = 0;
+		Vector<Node*> mFreeNodes;
+
+		static const size_t DEFAULT_NUM_BUCKETS = 8;
+		static const size_t FIRST_PAGE_SIZE = 4;
+		static const size_t MAX_LOAD_NUMERATOR = 4;
+		static const size_t MAX_LOAD_DENOMINATOR = 5;
+		static const size_t UNKNOWN_PAGE = static_cast<size_t>(-1);
+		static const size_t NOT_FOUND = static_cast<size_t>(-1);
+		static const HashFunctor mHashFunction;
+	};
+}
+#include "FlatHashMap.inl"
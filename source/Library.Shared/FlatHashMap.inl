@@ -0,0 +1,750 @@
+#pragma once
+#include "FlatHashMap.h"
+
+namespace Library
+{
+	template <typename TKey, typename TData, typename HashFunctor>
+	const HashFunctor FlatHashMap<TKey, TData, HashFunctor>::mHashFunction;
+
+#pragma region Node
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline typename FlatHashMap<TKey, TData, HashFunctor>::PairType& FlatHashMap<TKey, TData, HashFunctor>::Node::Pair()
+	{
+		return *reinterpret_cast<PairType*>(Storage);
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline const typename FlatHashMap<TKey, TData, HashFunctor>::PairType& FlatHashMap<TKey, TData, HashFunctor>::Node::Pair() const
+	{
+		return *reinterpret_cast<const PairType*>(Storage);
+	}
+
+#pragma endregion
+
+#pragma region FlatHashMap
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline FlatHashMap<TKey, TData, HashFunctor>::FlatHashMap(size_t numberOfBuckets) : FlatHashMap(MemoryResource::Default(), numberOfBuckets)
+	{
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline FlatHashMap<TKey, TData, HashFunctor>::FlatHashMap(MemoryResource& resource, size_t numberOfBuckets) :
+		mResource(&resource), mPages(resource), mFreeNodes(resource)
+	{
+		ResizeSlots(RoundUpToPowerOfTwo(numberOfBuckets));
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	FlatHashMap<TKey, TData, HashFunctor>::FlatHashMap(std::initializer_list<PairType> list) : FlatHashMap(static_cast<size_t>(list.size()))
+	{
+		for (const auto& value : list)
+		{
+			Insert(value);
+		}
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	FlatHashMap<TKey, TData, HashFunctor>::FlatHashMap(const FlatHashMap& rhs) : FlatHashMap(rhs.mSlotCount)
+	{
+		for (const auto& pair : rhs)
+		{
+			Insert(pair);
+		}
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	FlatHashMap<TKey, TData, HashFunctor>::FlatHashMap(FlatHashMap&& rhs) :
+		mResource(rhs.mResource), mSlots(rhs.mSlots), mSlotCount(rhs.mSlotCount), mShift(rhs.mShift), mSize(rhs.mSize),
+		mPages(std::move(rhs.mPages)), mLastPageUsed(rhs.mLastPageUsed), mFreeNodes(std::move(rhs.mFreeNodes))
+	{
+		rhs.mSlots = nullptr;
+		rhs.mSlotCount = 0;
+		rhs.mShift = 0;
+		rhs.mSize = 0;
+		rhs.mLastPageUsed = 0;
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	FlatHashMap<TKey, TData, HashFunctor>& FlatHashMap<TKey, TData, HashFunctor>::operator=(const FlatHashMap& rhs)
+	{
+		if (this != &rhs)
+		{
+			FlatHashMap copy(*mResource, rhs.mSlotCount);
+			for (const auto& pair : rhs)
+			{
+				copy.Insert(pair);
+			}
+			*this = std::move(copy);
+		}
+		return *this;
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	FlatHashMap<TKey, TData, HashFunctor>& FlatHashMap<TKey, TData, HashFunctor>::operator=(FlatHashMap&& rhs)
+	{
+		if (this != &rhs)
+		{
+			ReleasePages();
+			mResource->Deallocate(mSlots, mSlotCount * sizeof(Slot));
+
+			mResource = rhs.mResource;
+			mSlots = rhs.mSlots;
+			mSlotCount = rhs.mSlotCount;
+			mShift = rhs.mShift;
+			mSize = rhs.mSize;
+			mPages = std::move(rhs.mPages);
+			mLastPageUsed = rhs.mLastPageUsed;
+			mFreeNodes = std::move(rhs.mFreeNodes);
+
+			rhs.mSlots = nullptr;
+			rhs.mSlotCount = 0;
+			rhs.mShift = 0;
+			rhs.mSize = 0;
+			rhs.mLastPageUsed = 0;
+		}
+		return *this;
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	FlatHashMap<TKey, TData, HashFunctor>::~FlatHashMap()
+	{
+		ReleasePages();
+		mResource->Deallocate(mSlots, mSlotCount * sizeof(Slot));
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline TData& FlatHashMap<TKey, TData, HashFunctor>::operator[](const TKey& key)
+	{
+		return ((*(Insert(std::make_pair(key, TData())))).second);
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline typename FlatHashMap<TKey, TData, HashFunctor>::Iterator FlatHashMap<TKey, TData, HashFunctor>::Find(const TKey& key)
+	{
+		size_t index = FindSlot(key, mHashFunction(key));
+		return (index == NOT_FOUND ? end() : Iterator(*this, mSlots[index].Entry));
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline typename FlatHashMap<TKey, TData, HashFunctor>::ConstIterator FlatHashMap<TKey, TData, HashFunctor>::Find(const TKey& key) const
+	{
+		size_t index = FindSlot(key, mHashFunction(key));
+		return (index == NOT_FOUND ? end() : ConstIterator(*this, mSlots[index].Entry));
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline TData& FlatHashMap<TKey, TData, HashFunctor>::At(const TKey& key)
+	{
+		Iterator iter = Find(key);
+		if (iter == end())
+		{
+			throw std::runtime_error("Provided key is not in the hashmap!");
+		}
+		return iter->second;
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline const TData& FlatHashMap<TKey, TData, HashFunctor>::At(const TKey& key) const
+	{
+		ConstIterator iter = Find(key);
+		if (iter == end())
+		{
+			throw std::runtime_error("Provided key is not in the hashmap!");
+		}
+		return iter->second;
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	template <typename TLookup, typename Functor, typename>
+	inline typename FlatHashMap<TKey, TData, HashFunctor>::Iterator FlatHashMap<TKey, TData, HashFunctor>::Find(const TLookup& key)
+	{
+		size_t index = FindSlot(key, mHashFunction(key));
+		return (index == NOT_FOUND ? end() : Iterator(*this, mSlots[index].Entry));
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	template <typename TLookup, typename Functor, typename>
+	inline typename FlatHashMap<TKey, TData, HashFunctor>::ConstIterator FlatHashMap<TKey, TData, HashFunctor>::Find(const TLookup& key) const
+	{
+		size_t index = FindSlot(key, mHashFunction(key));
+		return (index == NOT_FOUND ? end() : ConstIterator(*this, mSlots[index].Entry));
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	template <typename TLookup, typename Functor, typename>
+	inline bool FlatHashMap<TKey, TData, HashFunctor>::ContainsKey(const TLookup& key)
+	{
+		return (FindSlot(key, mHashFunction(key)) != NOT_FOUND);
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	template <typename TLookup, typename Functor, typename>
+	inline TData& FlatHashMap<TKey, TData, HashFunctor>::At(const TLookup& key)
+	{
+		size_t index = FindSlot(key, mHashFunction(key));
+		if (index == NOT_FOUND)
+		{
+			throw std::runtime_error("Provided key is not in the hashmap!");
+		}
+		return mSlots[index].Entry->Pair().second;
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	template <typename TLookup, typename Functor, typename>
+	inline const TData& FlatHashMap<TKey, TData, HashFunctor>::At(const TLookup& key) const
+	{
+		size_t index = FindSlot(key, mHashFunction(key));
+		if (index == NOT_FOUND)
+		{
+			throw std::runtime_error("Provided key is not in the hashmap!");
+		}
+		return mSlots[index].Entry->Pair().second;
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline typename FlatHashMap<TKey, TData, HashFunctor>::Iterator FlatHashMap<TKey, TData, HashFunctor>::Insert(const PairType& pair)
+	{
+		bool result;
+		return Insert(pair, result);
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline typename FlatHashMap<TKey, TData, HashFunctor>::Iterator FlatHashMap<TKey, TData, HashFunctor>::Insert(const PairType& pair, bool& result)
+	{
+		return Insert(pair, mHashFunction(pair.first), result);
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	typename FlatHashMap<TKey, TData, HashFunctor>::Iterator FlatHashMap<TKey, TData, HashFunctor>::Insert(const PairType& pair, size_t hash, bool& result)
+	{
+		result = false;
+		size_t index = FindSlot(pair.first, hash);
+		if (index != NOT_FOUND)
+		{
+			return Iterator(*this, mSlots[index].Entry);
+		}
+
+		if ((mSize + 1) * MAX_LOAD_DENOMINATOR > mSlotCount * MAX_LOAD_NUMERATOR)
+		{
+			ResizeSlots(mSlotCount == 0 ? DEFAULT_NUM_BUCKETS : mSlotCount * 2);
+		}
+
+		Node* node = AllocateNode();
+		new (node->Storage)PairType(pair);
+		node->IsOccupied = true;
+		PlaceSlot(Slot{ hash, node });
+		++mSize;
+		result = true;
+		return Iterator(*this, node);
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline bool FlatHashMap<TKey, TData, HashFunctor>::ContainsKey(const TKey& key)
+	{
+		return (FindSlot(key, mHashFunction(key)) != NOT_FOUND);
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline bool FlatHashMap<TKey, TData, HashFunctor>::ContainsKey(const TKey& key, Iterator& iter)
+	{
+		iter = Find(key);
+		return (iter != end());
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	void FlatHashMap<TKey, TData, HashFunctor>::Remove(const TKey& key)
+	{
+		size_t index = FindSlot(key, mHashFunction(key));
+		if (index == NOT_FOUND)
+		{
+			return;
+		}
+
+		Node* node = mSlots[index].Entry;
+		node->Pair().~PairType();
+		node->IsOccupied = false;
+		mFreeNodes.PushBack(node);
+		--mSize;
+
+		//Backward shift deletion: pull the rest of the probe run one slot closer to home, no tombstones needed
+		size_t mask = mSlotCount - 1;
+		size_t next = (index + 1) & mask;
+		while (mSlots[next].Entry != nullptr && ProbeDistance(mSlots[next].Hash, next) != 0)
+		{
+			mSlots[index] = mSlots[next];
+			index = next;
+			next = (next + 1) & mask;
+		}
+		mSlots[index] = Slot();
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	void FlatHashMap<TKey, TData, HashFunctor>::Clear()
+	{
+		ReleasePages();
+		for (size_t i = 0; i < mSlotCount; ++i)
+		{
+			mSlots[i] = Slot();
+		}
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	void FlatHashMap<TKey, TData, HashFunctor>::Rehash(size_t numberOfBuckets)
+	{
+		size_t numberOfSlots = RoundUpToPowerOfTwo(numberOfBuckets);
+		while (mSize * MAX_LOAD_DENOMINATOR > numberOfSlots * MAX_LOAD_NUMERATOR)
+		{
+			numberOfSlots *= 2;
+		}
+		ResizeSlots(numberOfSlots);
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	void FlatHashMap<TKey, TData, HashFunctor>::ShrinkToFit()
+	{
+		size_t numberOfSlots = RoundUpToPowerOfTwo(mSize);
+		while (mSize * MAX_LOAD_DENOMINATOR > numberOfSlots * MAX_LOAD_NUMERATOR)
+		{
+			numberOfSlots *= 2;
+		}
+		if (numberOfSlots < mSlotCount)
+		{
+			ResizeSlots(numberOfSlots);
+		}
+		mPages.ShrinkToFit();
+		mFreeNodes.ShrinkToFit();
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	MemoryFootprint FlatHashMap<TKey, TData, HashFunctor>::Footprint() const
+	{
+		size_t nodes = 0;
+		for (size_t page = 0; page < mPages.Size(); ++page)
+		{
+			nodes += PageCapacity(page);
+		}
+
+		MemoryFootprint footprint = mPages.Footprint();
+		footprint += mFreeNodes.Footprint();
+		footprint.HashMapSlots = mSize * sizeof(Slot);
+		footprint.HashMapSlotSlack = (mSlotCount - mSize) * sizeof(Slot);
+		footprint.HashMapEntries = mSize * sizeof(Node);
+		footprint.HashMapEntrySlack = (nodes - mSize) * sizeof(Node);
+		return footprint;
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline size_t FlatHashMap<TKey, TData, HashFunctor>::Size() const
+	{
+		return mSize;
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline size_t FlatHashMap<TKey, TData, HashFunctor>::NumberOfBuckets() const
+	{
+		return mSlotCount;
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline float_t FlatHashMap<TKey, TData, HashFunctor>::LoadFactor() const
+	{
+		if (mSlotCount == 0)
+		{
+			return 0;
+		}
+		return (static_cast<float_t>(mSize)) / (static_cast<float_t>(mSlotCount));
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline typename FlatHashMap<TKey, TData, HashFunctor>::Iterator FlatHashMap<TKey, TData, HashFunctor>::begin()
+	{
+		size_t page = 0;
+		return Iterator(*this, const_cast<Node*>(FirstOccupied(page, 0)), page);
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline typename FlatHashMap<TKey, TData, HashFunctor>::ConstIterator FlatHashMap<TKey, TData, HashFunctor>::begin() const
+	{
+		size_t page = 0;
+		const Node* node = FirstOccupied(page, 0);
+		return ConstIterator(*this, node, page);
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline typename FlatHashMap<TKey, TData, HashFunctor>::ConstIterator FlatHashMap<TKey, TData, HashFunctor>::cbegin() const
+	{
+		return begin();
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline typename FlatHashMap<TKey, TData, HashFunctor>::Iterator FlatHashMap<TKey, TData, HashFunctor>::end()
+	{
+		return Iterator(*this, nullptr, mPages.Size());
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline typename FlatHashMap<TKey, TData, HashFunctor>::ConstIterator FlatHashMap<TKey, TData, HashFunctor>::end() const
+	{
+		return ConstIterator(*this, nullptr, mPages.Size());
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline typename FlatHashMap<TKey, TData, HashFunctor>::ConstIterator FlatHashMap<TKey, TData, HashFunctor>::cend() const
+	{
+		return end();
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline MemoryResource& FlatHashMap<TKey, TData, HashFunctor>::Resource() const
+	{
+		return *mResource;
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	template <typename TLookup>
+	inline size_t FlatHashMap<TKey, TData, HashFunctor>::FindSlot(const TLookup& key, size_t hash) const
+	{
+		if (mSize == 0)
+		{
+			return NOT_FOUND;
+		}
+
+		size_t mask = mSlotCount - 1;
+		size_t index = HomeSlot(hash);
+		for (size_t distance = 0; ; ++distance)
+		{
+			const Slot& slot = mSlots[index];
+
+			//Robin Hood invariant: once we pass a slot that is closer to its home than we are to ours, the key cannot be further along
+			if (slot.Entry == nullptr || ProbeDistance(slot.Hash, index) < distance)
+			{
+				return NOT_FOUND;
+			}
+			if (slot.Hash == hash && slot.Entry->Pair().first == key)
+			{
+				return index;
+			}
+			index = (index + 1) & mask;
+		}
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline size_t FlatHashMap<TKey, TData, HashFunctor>::HomeSlot(size_t hash) const
+	{
+		//Fibonacci hashing -- take the top bits of the product so weak low bits in the key hash don't cluster
+		const size_t multiplier = (sizeof(size_t) == 8 ? static_cast<size_t>(11400714819323198485ull) : static_cast<size_t>(2654435769u));
+		return (hash * multiplier) >> mShift;
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline size_t FlatHashMap<TKey, TData, HashFunctor>::ProbeDistance(size_t hash, size_t index) const
+	{
+		return (index + mSlotCount - HomeSlot(hash)) & (mSlotCount - 1);
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	void FlatHashMap<TKey, TData, HashFunctor>::PlaceSlot(Slot slot)
+	{
+		size_t mask = mSlotCount - 1;
+		size_t index = HomeSlot(slot.Hash);
+		size_t distance = 0;
+
+		for (;;)
+		{
+			Slot& current = mSlots[index];
+			if (current.Entry == nullptr)
+			{
+				current = slot;
+				return;
+			}
+
+			size_t currentDistance = ProbeDistance(current.Hash, index);
+			if (currentDistance < distance)
+			{
+				std::swap(current, slot);
+				distance = currentDistance;
+			}
+			index = (index + 1) & mask;
+			++distance;
+		}
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	void FlatHashMap<TKey, TData, HashFunctor>::ResizeSlots(size_t numberOfSlots)
+	{
+		Slot* oldSlots = mSlots;
+		size_t oldSlotCount = mSlotCount;
+
+		mSlots = static_cast<Slot*>(mResource->Allocate(numberOfSlots * sizeof(Slot)));
+		for (size_t i = 0; i < numberOfSlots; ++i)
+		{
+			new (mSlots + i)Slot();
+		}
+		mSlotCount = numberOfSlots;
+		mShift = sizeof(size_t) * 8;
+		for (size_t count = numberOfSlots; count > 1; count >>= 1)
+		{
+			--mShift;
+		}
+
+		for (size_t i = 0; i < oldSlotCount; ++i)
+		{
+			if (oldSlots[i].Entry != nullptr)
+			{
+				PlaceSlot(oldSlots[i]);
+			}
+		}
+		mResource->Deallocate(oldSlots, oldSlotCount * sizeof(Slot));
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	typename FlatHashMap<TKey, TData, HashFunctor>::Node* FlatHashMap<TKey, TData, HashFunctor>::AllocateNode()
+	{
+		if (!mFreeNodes.IsEmpty())
+		{
+			Node* node = mFreeNodes.Back();
+			mFreeNodes.PopBack();
+			return node;
+		}
+
+		if (mPages.IsEmpty() || mLastPageUsed == PageCapacity(mPages.Size() - 1))
+		{
+			size_t capacity = PageCapacity(mPages.Size());
+			Node* nodes = static_cast<Node*>(mResource->Allocate(capacity * sizeof(Node)));
+			for (size_t i = 0; i < capacity; ++i)
+			{
+				new (nodes + i)Node();
+			}
+			mPages.PushBack(nodes);
+			mLastPageUsed = 0;
+		}
+		return mPages.Back() + mLastPageUsed++;
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	void FlatHashMap<TKey, TData, HashFunctor>::ReleasePages()
+	{
+		for (size_t page = 0; page < mPages.Size(); ++page)
+		{
+			Node* nodes = mPages[page];
+			size_t capacity = PageCapacity(page);
+			for (size_t i = 0; i < capacity; ++i)
+			{
+				if (nodes[i].IsOccupied)
+				{
+					nodes[i].Pair().~PairType();
+				}
+			}
+			mResource->Deallocate(nodes, capacity * sizeof(Node));
+		}
+		mPages.Clear();
+		mFreeNodes.Clear();
+		mLastPageUsed = 0;
+		mSize = 0;
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline size_t FlatHashMap<TKey, TData, HashFunctor>::PageCapacity(size_t page) const
+	{
+		return (FIRST_PAGE_SIZE << page);
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	size_t FlatHashMap<TKey, TData, HashFunctor>::PageOf(const Node* node) const
+	{
+		std::less<const Node*> less;
+		for (size_t page = 0; page < mPages.Size(); ++page)
+		{
+			const Node* first = mPages[page];
+			if (!less(node, first) && less(node, first + PageCapacity(page)))
+			{
+				return page;
+			}
+		}
+		throw std::runtime_error("Node does not belong to this hashmap!");
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	const typename FlatHashMap<TKey, TData, HashFunctor>::Node* FlatHashMap<TKey, TData, HashFunctor>::FirstOccupied(size_t& page, size_t offset) const
+	{
+		for (; page < mPages.Size(); ++page, offset = 0)
+		{
+			const Node* nodes = mPages[page];
+			size_t used = (page == mPages.Size() - 1 ? mLastPageUsed : PageCapacity(page));
+			for (; offset < used; ++offset)
+			{
+				if (nodes[offset].IsOccupied)
+				{
+					return nodes + offset;
+				}
+			}
+		}
+		return nullptr;
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline size_t FlatHashMap<TKey, TData, HashFunctor>::RoundUpToPowerOfTwo(size_t value)
+	{
+		size_t result = 2;
+		while (result < value)
+		{
+			result <<= 1;
+		}
+		return result;
+	}
+
+#pragma endregion
+
+#pragma region Iterator
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline FlatHashMap<TKey, TData, HashFunctor>::Iterator::Iterator(FlatHashMap& owner, Node* node, size_t page) :
+		mNode(node), mPage(page), mOwner(&owner)
+	{
+
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	typename FlatHashMap<TKey, TData, HashFunctor>::Iterator& FlatHashMap<TKey, TData, HashFunctor>::Iterator::operator++()
+	{
+		if (mOwner == nullptr)
+		{
+			throw std::runtime_error("Iterator doesn't have valid owner!");
+		}
+		if (mNode == nullptr)
+		{
+			throw std::runtime_error("Iterator is already at the end, cannot be incremented!");
+		}
+
+		if (mPage == UNKNOWN_PAGE)
+		{
+			mPage = mOwner->PageOf(mNode);
+		}
+		size_t offset = static_cast<size_t>(mNode - mOwner->mPages[mPage]) + 1;
+		mNode = const_cast<Node*>(mOwner->FirstOccupied(mPage, offset));
+		return *this;
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline typename FlatHashMap<TKey, TData, HashFunctor>::Iterator FlatHashMap<TKey, TData, HashFunctor>::Iterator::operator++(int)
+	{
+		Iterator iter = *this;
+		operator++();
+		return iter;
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline typename FlatHashMap<TKey, TData, HashFunctor>::PairType& FlatHashMap<TKey, TData, HashFunctor>::Iterator::operator*() const
+	{
+		if (mOwner == nullptr)
+		{
+			throw std::runtime_error("Iterator doesn't have valid owner!");
+		}
+		if (mNode == nullptr)
+		{
+			throw std::runtime_error("Cannot dereference the end of the hashmap!");
+		}
+		return mNode->Pair();
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline typename FlatHashMap<TKey, TData, HashFunctor>::PairType* FlatHashMap<TKey, TData, HashFunctor>::Iterator::operator->() const
+	{
+		return &(operator*());
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline bool FlatHashMap<TKey, TData, HashFunctor>::Iterator::operator==(const Iterator& rhs) const
+	{
+		return (mOwner == rhs.mOwner) && (mNode == rhs.mNode);
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline bool FlatHashMap<TKey, TData, HashFunctor>::Iterator::operator!=(const Iterator& rhs) const
+	{
+		return !(*this == rhs);
+	}
+
+#pragma endregion
+
+#pragma region ConstIterator
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline FlatHashMap<TKey, TData, HashFunctor>::ConstIterator::ConstIterator(const FlatHashMap& owner, const Node* node, size_t page) :
+		mNode(node), mPage(page), mOwner(&owner)
+	{
+
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline FlatHashMap<TKey, TData, HashFunctor>::ConstIterator::ConstIterator(const Iterator& rhs) :
+		mNode(rhs.mNode), mPage(rhs.mPage), mOwner(rhs.mOwner)
+	{
+
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	typename FlatHashMap<TKey, TData, HashFunctor>::ConstIterator& FlatHashMap<TKey, TData, HashFunctor>::ConstIterator::operator++()
+	{
+		if (mOwner == nullptr)
+		{
+			throw std::runtime_error("Iterator doesn't have valid owner!");
+		}
+		if (mNode == nullptr)
+		{
+			throw std::runtime_error("Iterator is already at the end, cannot be incremented!");
+		}
+
+		if (mPage == UNKNOWN_PAGE)
+		{
+			mPage = mOwner->PageOf(mNode);
+		}
+		size_t offset = static_cast<size_t>(mNode - mOwner->mPages[mPage]) + 1;
+		mNode = mOwner->FirstOccupied(mPage, offset);
+		return *this;
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline typename FlatHashMap<TKey, TData, HashFunctor>::ConstIterator FlatHashMap<TKey, TData, HashFunctor>::ConstIterator::operator++(int)
+	{
+		ConstIterator iter = *this;
+		operator++();
+		return iter;
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline const typename FlatHashMap<TKey, TData, HashFunctor>::PairType& FlatHashMap<TKey, TData, HashFunctor>::ConstIterator::operator*() const
+	{
+		if (mOwner == nullptr)
+		{
+			throw std::runtime_error("Iterator doesn't have valid owner!");
+		}
+		if (mNode == nullptr)
+		{
+			throw std::runtime_error("Cannot dereference the end of the hashmap!");
+		}
+		return mNode->Pair();
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline const typename FlatHashMap<TKey, TData, HashFunctor>::PairType* FlatHashMap<TKey, TData, HashFunctor>::ConstIterator::operator->() const
+	{
+		return &(operator*());
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline bool FlatHashMap<TKey, TData, HashFunctor>::ConstIterator::operator==(const ConstIterator& rhs) const
+	{
+		return (mOwner == rhs.mOwner) && (mNode == rhs.mNode);
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline bool FlatHashMap<TKey, TData, HashFunctor>::ConstIterator::operator!=(const ConstIterator& rhs) const
+	{
+		return !(*this == rhs);
+	}
+
+#pragma endregion
+}
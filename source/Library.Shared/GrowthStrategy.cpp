@@ -0,0 +1,58 @@
+#include "pch.h"
+#include "GrowthStrategy.h"
+
+namespace Library
+{
+	namespace
+	{
+		thread_local GrowthStrategy sCurrentStrategy = nullptr;
+	}
+
+	size_t IncrementStrategy::operator()(size_t size, size_t capacity) const
+	{
+		return Grow(size, capacity);
+	}
+
+	size_t IncrementStrategy::Grow(size_t size, size_t capacity)
+	{
+		if (size == 0 && capacity == 0)
+		{
+			return 5;
+		}
+		return capacity * 2;
+	}
+
+	size_t DoublingStrategy::Grow(size_t /*size*/, size_t capacity)
+	{
+		return capacity * 2 + 1;
+	}
+
+	size_t GoldenRatioStrategy::Grow(size_t /*size*/, size_t capacity)
+	{
+		if (capacity < MINIMUM_CAPACITY)
+		{
+			return MINIMUM_CAPACITY;
+		}
+		return capacity + (capacity * 618) / 1000 + 1;
+	}
+
+	size_t ExactFitStrategy::Grow(size_t size, size_t capacity)
+	{
+		return (size < capacity ? capacity : size) + 1;
+	}
+
+	GrowthStrategyGuard::GrowthStrategyGuard(GrowthStrategy strategy) : mPrevious(sCurrentStrategy)
+	{
+		sCurrentStrategy = strategy;
+	}
+
+	GrowthStrategyGuard::~GrowthStrategyGuard()
+	{
+		sCurrentStrategy = mPrevious;
+	}
+
+	GrowthStrategy GrowthStrategyGuard::Current(GrowthStrategy fallback)
+	{
+		return (sCurrentStrategy != nullptr ? sCurrentStrategy : fallback);
+	}
+}
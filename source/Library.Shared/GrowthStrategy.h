@@ -0,0 +1,96 @@
+#pragma once
+#include <cstddef>
+
+namespace Library
+{
+	/// <summary>
+	/// Growth policy of Vector and Datum: given the size and capacity of a full container, returns the capacity to grow to.
+	/// Must return more than the current capacity.
+	/// </summary>
+	using GrowthStrategy = size_t(*)(size_t size, size_t capacity);
+
+	/// <summary>
+	/// Default Vector strategy, starts at 5 elements and doubles
+	/// </summary>
+	class IncrementStrategy final
+	{
+	public:
+		size_t operator()(size_t size, size_t capacity) const;
+		static size_t Grow(size_t size, size_t capacity);
+	};
+
+	/// <summary>
+	/// Default Datum strategy, doubles plus one so a single element fits without a second allocation
+	/// </summary>
+	class DoublingStrategy final
+	{
+	public:
+		static size_t Grow(size_t size, size_t capacity);
+	};
+
+	/// <summary>
+	/// Grows by the golden ratio. Wastes less memory than doubling and lets freed blocks be reused by later growth.
+	/// </summary>
+	class GoldenRatioStrategy final
+	{
+	public:
+		static const size_t MINIMUM_CAPACITY = 4;
+		static size_t Grow(size_t size, size_t capacity);
+	};
+
+	/// <summary>
+	/// Grows by a fixed number of elements, bounds the slack of large containers at the cost of more reallocations
+	/// </summary>
+	template <size_t ChunkSize>
+	class FixedChunkStrategy final
+	{
+		static_assert(ChunkSize > 0, "Chunk size must be greater than 0");
+
+	public:
+		static size_t Grow(size_t /*size*/, size_t capacity)
+		{
+			return capacity + ChunkSize;
+		}
+	};
+
+	/// <summary>
+	/// Grows by exactly one element. Meant for containers filled once whose final size is known or reserved up front,
+	/// such as the data loaded from JSON, so that no slack is left behind.
+	/// </summary>
+	class ExactFitStrategy final
+	{
+	public:
+		static size_t Grow(size_t size, size_t capacity);
+	};
+
+	/// <summary>
+	/// Overrides the growth strategy of every Vector and Datum constructed on the calling thread while the guard is alive,
+	/// e.g. while a World is parsed from JSON
+	/// </summary>
+	class GrowthStrategyGuard final
+	{
+	public:
+		/// <summary>
+		/// Installs the strategy
+		/// </summary>
+		/// <param name="strategy">Strategy to install</param>
+		explicit GrowthStrategyGuard(GrowthStrategy strategy);
+		GrowthStrategyGuard(const GrowthStrategyGuard&) = delete;
+		GrowthStrategyGuard& operator=(const GrowthStrategyGuard&) = delete;
+
+		/// <summary>
+		/// Restores the previous strategy
+		/// </summary>
+		~GrowthStrategyGuard();
+
+		/// <summary>
+		/// Provides the strategy installed on the calling thread
+		/// </summary>
+		/// <param name="fallback">Strategy to use when no guard is alive</param>
+		/// <returns>Installed strategy, or the fallback</returns>
+		static GrowthStrategy Current(GrowthStrategy fallback);
+
+	private:
+		GrowthStrategy mPrevious;
+	};
+}
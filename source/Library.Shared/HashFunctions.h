@@ -1,14 +1,51 @@
 #pragma once
 #include <cstring>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
 
 namespace Library
 {
+	class InternedString;
+
+	/// <summary>
+	/// wyhash-style byte hash: reads the input 16 bytes at a time and folds it with 64x64->128 bit multiplies
+	/// </summary>
+	/// <param name="data">Pointer to the bytes to hash</param>
+	/// <param name="size">Number of bytes to hash</param>
+	/// <param name="seed">Seed mixed into the hash</param>
+	/// <returns>64-bit hash of the bytes</returns>
+	std::uint64_t ByteHash(const void* data, size_t size, std::uint64_t seed = 0);
+
+	/// <summary>
+	/// Mixes a 64-bit integer so that every input bit affects every output bit
+	/// </summary>
+	/// <param name="value">Integer to mix</param>
+	/// <returns>Mixed 64-bit value</returns>
+	std::uint64_t IntegerHash(std::uint64_t value);
+
+	/// <summary>
+	/// Legacy hash that sums 127 times each byte. Kept for comparison in benchmarks only.
+	/// </summary>
+	/// <param name="data">Pointer to the bytes to hash</param>
+	/// <param name="size">Number of bytes to hash</param>
+	/// <returns>Sum of the weighted bytes</returns>
+	size_t AdditiveHash(const std::uint8_t* data, size_t size);
+
 	template <typename TKey>
 
+	/// <summary>
+	/// Default hash functor. Integers, enums and pointers go through IntegerHash, other types hash their bytes with ByteHash.
+	/// </summary>
 	class HashFunctions
 	{
 	public:
 		size_t operator()(const TKey& key) const;
+
+	private:
+		static size_t Hash(const TKey& key, std::true_type);
+		static size_t Hash(const TKey& key, std::false_type);
 	};
 
 	template <>
@@ -19,10 +56,35 @@ namespace Library
 	};
 
 	template <>
+	class HashFunctions<const char*>
+	{
+	public:
+		size_t operator()(const char* key) const;
+	};
+
+	template <>
+
+	/// <summary>
+	/// String hash functor. Marked transparent so maps keyed by std::string can be searched with
+	/// std::string_view or const char* keys; all three produce the same hash for the same characters.
+	/// InternedString keys reuse their precomputed hash (the overload is defined in InternedString.h).
+	/// </summary>
 	class HashFunctions<std::string>
 	{
 	public:
+		using is_transparent = void;
+
 		size_t operator()(const std::string& key) const;
+		size_t operator()(std::string_view key) const;
+		size_t operator()(const char* key) const;
+		size_t operator()(const InternedString& key) const;
+	};
+
+	template <>
+	class HashFunctions<std::string_view>
+	{
+	public:
+		size_t operator()(std::string_view key) const;
 	};
 }
-#include "HashFunctions.inl"
\ No newline at end of file
+#include "HashFunctions.inl"
\ No newline at end of file
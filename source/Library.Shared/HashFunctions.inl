@@ -1,9 +1,135 @@
 #include "pch.h"
 #include "HashFunctions.h"
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
 
 namespace Library
 {
-	inline size_t AdditiveHash(const uint8_t* data, size_t size)
+	namespace HashDetail
+	{
+		const std::uint64_t Secret[4] = { 0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull };
+
+		inline void Multiply(std::uint64_t& low, std::uint64_t& high)
+		{
+#if defined(_MSC_VER) && defined(_M_X64)
+			low = _umul128(low, high, &high);
+#elif defined(__SIZEOF_INT128__)
+			unsigned __int128 product = static_cast<unsigned __int128>(low) * high;
+			low = static_cast<std::uint64_t>(product);
+			high = static_cast<std::uint64_t>(product >> 64);
+#else
+			//32-bit targets build the 128-bit product from four 32x32 multiplies
+			std::uint64_t lowLow = (low & 0xffffffff) * (high & 0xffffffff);
+			std::uint64_t lowHigh = (low & 0xffffffff) * (high >> 32);
+			std::uint64_t highLow = (low >> 32) * (high & 0xffffffff);
+			std::uint64_t highHigh = (low >> 32) * (high >> 32);
+			std::uint64_t middle = (lowLow >> 32) + (lowHigh & 0xffffffff) + (highLow & 0xffffffff);
+			low = (lowLow & 0xffffffff) | (middle << 32);
+			high = highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+#endif
+		}
+
+		inline std::uint64_t Mix(std::uint64_t a, std::uint64_t b)
+		{
+			Multiply(a, b);
+			return a ^ b;
+		}
+
+		inline std::uint64_t Read8(const std::uint8_t* data)
+		{
+			std::uint64_t value;
+			memcpy(&value, data, sizeof(value));
+			return value;
+		}
+
+		inline std::uint64_t Read4(const std::uint8_t* data)
+		{
+			std::uint32_t value;
+			memcpy(&value, data, sizeof(value));
+			return value;
+		}
+
+		inline std::uint64_t Read3(const std::uint8_t* data, size_t size)
+		{
+			return (static_cast<std::uint64_t>(data[0]) << 16) | (static_cast<std::uint64_t>(data[size >> 1]) << 8) | data[size - 1];
+		}
+
+		inline size_t Fold(std::uint64_t hash)
+		{
+			//32-bit targets keep the high half's entropy by folding it into the low half
+			return static_cast<size_t>(sizeof(size_t) < sizeof(std::uint64_t) ? (hash ^ (hash >> 32)) : hash);
+		}
+	}
+
+	inline std::uint64_t ByteHash(const void* data, size_t size, std::uint64_t seed)
+	{
+		using namespace HashDetail;
+		const std::uint8_t* bytes = reinterpret_cast<const std::uint8_t*>(data);
+		seed ^= Mix(seed ^ Secret[0], Secret[1]);
+		std::uint64_t a;
+		std::uint64_t b;
+
+		if (size <= 16)
+		{
+			if (size >= 4)
+			{
+				a = (Read4(bytes) << 32) | Read4(bytes + ((size >> 3) << 2));
+				b = (Read4(bytes + size - 4) << 32) | Read4(bytes + size - 4 - ((size >> 3) << 2));
+			}
+			else if (size > 0)
+			{
+				a = Read3(bytes, size);
+				b = 0;
+			}
+			else
+			{
+				a = b = 0;
+			}
+		}
+		else
+		{
+			size_t remaining = size;
+			if (remaining > 48)
+			{
+				std::uint64_t seed1 = seed;
+				std::uint64_t seed2 = seed;
+				do
+				{
+					seed = Mix(Read8(bytes) ^ Secret[1], Read8(bytes + 8) ^ seed);
+					seed1 = Mix(Read8(bytes + 16) ^ Secret[2], Read8(bytes + 24) ^ seed1);
+					seed2 = Mix(Read8(bytes + 32) ^ Secret[3], Read8(bytes + 40) ^ seed2);
+					bytes += 48;
+					remaining -= 48;
+				} while (remaining > 48);
+				seed ^= seed1 ^ seed2;
+			}
+			while (remaining > 16)
+			{
+				seed = Mix(Read8(bytes) ^ Secret[1], Read8(bytes + 8) ^ seed);
+				bytes += 16;
+				remaining -= 16;
+			}
+			a = Read8(bytes + remaining - 16);
+			b = Read8(bytes + remaining - 8);
+		}
+
+		a ^= Secret[1];
+		b ^= seed;
+		Multiply(a, b);
+		return Mix(a ^ Secret[0] ^ size, b ^ Secret[1]);
+	}
+
+	inline std::uint64_t IntegerHash(std::uint64_t value)
+	{
+		using namespace HashDetail;
+		std::uint64_t a = value ^ Secret[0];
+		std::uint64_t b = Secret[1];
+		Multiply(a, b);
+		return Mix(a ^ Secret[0], b ^ Secret[1]);
+	}
+
+	inline size_t AdditiveHash(const std::uint8_t* data, size_t size)
 	{
 		size_t hash = 0;
 		const size_t prime = 127;
@@ -17,16 +143,51 @@ namespace Library
 	template <typename TKey>
 	inline size_t HashFunctions<TKey>::operator()(const TKey& key) const
 	{
-		return AdditiveHash(reinterpret_cast<const uint8_t*>(&key), sizeof(key));
+		using IsScalar = std::integral_constant<bool, (std::is_integral<TKey>::value || std::is_enum<TKey>::value || std::is_pointer<TKey>::value) && sizeof(TKey) <= sizeof(std::uint64_t)>;
+		return Hash(key, IsScalar());
+	}
+
+	template <typename TKey>
+	inline size_t HashFunctions<TKey>::Hash(const TKey& key, std::true_type)
+	{
+		std::uint64_t value = 0;
+		memcpy(&value, &key, sizeof(key));
+		return HashDetail::Fold(IntegerHash(value));
+	}
+
+	template <typename TKey>
+	inline size_t HashFunctions<TKey>::Hash(const TKey& key, std::false_type)
+	{
+		return HashDetail::Fold(ByteHash(&key, sizeof(key)));
 	}
 
 	inline size_t HashFunctions<char*>::operator()(const char* key) const
 	{
-		return AdditiveHash(reinterpret_cast<const uint8_t*>(key), strlen(key));
+		return HashDetail::Fold(ByteHash(key, strlen(key)));
+	}
+
+	inline size_t HashFunctions<const char*>::operator()(const char* key) const
+	{
+		return HashDetail::Fold(ByteHash(key, strlen(key)));
 	}
 
 	inline size_t HashFunctions<std::string>::operator()(const std::string& key) const
 	{
-		return AdditiveHash(reinterpret_cast<const uint8_t*>(key.c_str()), key.size());
+		return HashDetail::Fold(ByteHash(key.data(), key.size()));
+	}
+
+	inline size_t HashFunctions<std::string>::operator()(std::string_view key) const
+	{
+		return HashDetail::Fold(ByteHash(key.data(), key.size()));
+	}
+
+	inline size_t HashFunctions<std::string>::operator()(const char* key) const
+	{
+		return HashDetail::Fold(ByteHash(key, strlen(key)));
+	}
+
+	inline size_t HashFunctions<std::string_view>::operator()(std::string_view key) const
+	{
+		return HashDetail::Fold(ByteHash(key.data(), key.size()));
 	}
-}
\ No newline at end of file
+}
\ No newline at end of file
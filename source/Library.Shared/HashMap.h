@@ -221,6 +221,13 @@ namespace Library
 		/// <param name="numberOfBuckets">Size of the hash table array (number of buckets)</param>
 		explicit HashMap(size_t numberOfBuckets = DEFAULT_NUM_BUCKETS);
 
+		/// <summary>
+		/// Constructor that allocates buckets and entries from the provided resource instead of the default one
+		/// </summary>
+		/// <param name="resource">Resource the buckets and entries are allocated from</param>
+		/// <param name="numberOfBuckets">Size of the hash table array (number of buckets)</param>
+		explicit HashMap(MemoryResource& resource, size_t numberOfBuckets = DEFAULT_NUM_BUCKETS);
+
 		/// <summary>
 		/// Initializer list constructor
 		/// </summary>
@@ -228,7 +235,7 @@ namespace Library
 		HashMap(std::initializer_list<PairType> list);
 
 		/// <summary>
-		/// Copy constructor
+		/// Copy constructor, the copy allocates from the default resource
 		/// </summary>
 		/// <param name="rhs">Const reference of hashmap to be copied</param>
 		HashMap(const HashMap& rhs) = default;
@@ -272,6 +279,23 @@ namespace Library
 		/// <returns>ConstIterator to an element or to the end</returns>
 		ConstIterator Find(const TKey& key) const;
 
+		/// <summary>
+		/// Heterogeneous Find: searches with a key of another type (e.g. std::string_view or const char* for std::string keys)
+		/// without constructing a TKey. Only available when the hash functor declares is_transparent.
+		/// </summary>
+		/// <param name="key">Key comparable with TKey and hashable by HashFunctor</param>
+		/// <returns>Iterator to an element found or iterator to the end</returns>
+		template <typename TLookup, typename Functor = HashFunctor, typename = typename Functor::is_transparent>
+		Iterator Find(const TLookup& key);
+
+		/// <summary>
+		/// Const version of heterogeneous Find
+		/// </summary>
+		/// <param name="key">Key comparable with TKey and hashable by HashFunctor</param>
+		/// <returns>ConstIterator to an element or to the end</returns>
+		template <typename TLookup, typename Functor = HashFunctor, typename = typename Functor::is_transparent>
+		ConstIterator Find(const TLookup& key) const;
+
 		/// <summary>
 		/// Inserts element into the hashmap
 		/// </summary>
@@ -300,11 +324,50 @@ namespace Library
 		void Clear();
 
 		/// <summary>
-		/// Rehashes the hashmap
+		/// Rehashes the hashmap, relinking existing entries into the new buckets instead of copying them
 		/// </summary>
 		/// <param name="numberOfBuckets">New number of buckets to be used during rehash</param>
+		/// <exception cref="Invalid bucket count">Number of buckets is zero</exception>
 		void Rehash(size_t numberOfBuckets);
 
+		/// <summary>
+		/// Returns the average chain length past which the table grows on insert
+		/// </summary>
+		/// <returns>Maximum load factor (zero when automatic growth is disabled)</returns>
+		float_t MaxLoadFactor() const;
+
+		/// <summary>
+		/// Sets the average chain length past which the table grows on insert
+		/// </summary>
+		/// <param name="maxLoadFactor">Maximum load factor, zero disables automatic growth</param>
+		/// <exception cref="Invalid load factor">Load factor is negative</exception>
+		void SetMaxLoadFactor(float_t maxLoadFactor);
+
+		/// <summary>
+		/// Returns whether automatic growth is spread across later operations
+		/// </summary>
+		/// <returns>True if incremental rehash is enabled</returns>
+		bool IsIncrementalRehash() const;
+
+		/// <summary>
+		/// Enables or disables incremental rehash. When enabled, growing keeps the old buckets alive
+		/// and each Insert, Find and Remove relinks a few of them into the new buckets.
+		/// Iterators (but not references to pairs) are invalidated whenever entries are relinked.
+		/// </summary>
+		/// <param name="incremental">True to spread growth across later operations</param>
+		void SetIncrementalRehash(bool incremental);
+
+		/// <summary>
+		/// Returns whether an incremental rehash is still draining old buckets
+		/// </summary>
+		/// <returns>True if old buckets still hold entries</returns>
+		bool IsRehashing() const;
+
+		/// <summary>
+		/// Relinks every entry still waiting in the old buckets of an incremental rehash
+		/// </summary>
+		void FinishRehash();
+
 		/// <summary>
 		/// Returns population of the table
 		/// </summary>
@@ -312,13 +375,13 @@ namespace Library
 		size_t Size() const;
 
 		/// <summary>
-		/// Provides ratio of used buckets to total buckets in hashmap
+		/// Provides ratio of used buckets to total buckets in hashmap (excluding buckets still being drained by a rehash)
 		/// </summary>
 		/// <returns>Load factor (aforementioned ratio)</returns>
 		float_t LoadFactor() const;
 
 		/// <summary>
-		/// Provides total number of buckets in the hashmap
+		/// Provides total number of buckets in the hashmap (the target size while an incremental rehash is in progress)
 		/// </summary>
 		/// <returns>Total number of buckets</returns>
 		size_t NumberOfBuckets() const;
@@ -352,6 +415,30 @@ namespace Library
 		/// <returns>Const TData Reference</returns>
 		const TData& At(const TKey& key) const;
 
+		/// <summary>
+		/// Heterogeneous ContainsKey, see heterogeneous Find
+		/// </summary>
+		/// <param name="key">Key comparable with TKey and hashable by HashFunctor</param>
+		/// <returns>True if key is in hash map, false if not</returns>
+		template <typename TLookup, typename Functor = HashFunctor, typename = typename Functor::is_transparent>
+		bool ContainsKey(const TLookup& key);
+
+		/// <summary>
+		/// Heterogeneous At, see heterogeneous Find
+		/// </summary>
+		/// <param name="key">Key comparable with TKey and hashable by HashFunctor</param>
+		/// <returns>TData reference</returns>
+		template <typename TLookup, typename Functor = HashFunctor, typename = typename Functor::is_transparent>
+		TData& At(const TLookup& key);
+
+		/// <summary>
+		/// Const version of heterogeneous At
+		/// </summary>
+		/// <param name="key">Key comparable with TKey and hashable by HashFunctor</param>
+		/// <returns>Const TData Reference</returns>
+		template <typename TLookup, typename Functor = HashFunctor, typename = typename Functor::is_transparent>
+		const TData& At(const TLookup& key) const;
+
 		/// <summary>
 		/// Provides iterator to first element in hashmap
 		/// </summary>
@@ -388,12 +475,33 @@ namespace Library
 		/// <returns>ConstIterator to the end of the hashmap</returns>
 		ConstIterator cend() const;
 
+		/// <summary>
+		/// Provides the resource the buckets and entries are allocated from
+		/// </summary>
+		/// <returns>Reference to the memory resource</returns>
+		MemoryResource& Resource() const;
+
 	private:
-		Iterator Find(const TKey& key, size_t& index);
+		template <typename TLookup>
+		Iterator Find(const TLookup& key, size_t& index);
+		template <typename TLookup>
+		ConstIterator FindConst(const TLookup& key) const;
+		void GrowIfNeeded();
+		void MigrateBuckets(size_t count);
+		size_t BucketCount() const;
+		ChainType& Bucket(size_t index);
+		const ChainType& Bucket(size_t index) const;
+		BucketType MakeBuckets(size_t numberOfBuckets) const;
 
 		BucketType mBuckets;
+		BucketType mOldBuckets;
+		size_t mMigrationIndex = 0;
 		size_t mSize;
+		float_t mMaxLoadFactor = DEFAULT_MAX_LOAD_FACTOR;
+		bool mIncrementalRehash = false;
 		static const size_t DEFAULT_NUM_BUCKETS = 5;
+		static const size_t MIGRATION_STEP = 4;
+		static constexpr float_t DEFAULT_MAX_LOAD_FACTOR = 1.0f;
 		static const HashFunctor mHashFunction;
 	};
 }
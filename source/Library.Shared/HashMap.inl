@@ -18,9 +18,14 @@ namespace Library
 
 
 	template <typename TKey, typename TData, typename HashFunctor>
-	inline HashMap<TKey, TData, HashFunctor>::HashMap(size_t numberOfBuckets) : mSize(0), mBuckets(0)
+	inline HashMap<TKey, TData, HashFunctor>::HashMap(size_t numberOfBuckets) : HashMap(MemoryResource::Default(), numberOfBuckets)
 	{
-		mBuckets.Resize(numberOfBuckets);
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline HashMap<TKey, TData, HashFunctor>::HashMap(MemoryResource& resource, size_t numberOfBuckets) : mSize(0), mBuckets(resource), mOldBuckets(resource)
+	{
+		mBuckets = MakeBuckets(numberOfBuckets);
 	}
 
 	template <typename TKey, typename TData, typename HashFunctor>
@@ -34,44 +39,101 @@ namespace Library
 	template <typename TKey, typename TData, typename HashFunctor>
 	inline typename HashMap<TKey, TData, HashFunctor>::Iterator HashMap<TKey, TData, HashFunctor>::Find(const TKey& key)
 	{
+		MigrateBuckets(MIGRATION_STEP);
+		size_t index;
+		return Find(key, index);
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	template <typename TLookup, typename Functor, typename>
+	inline typename HashMap<TKey, TData, HashFunctor>::Iterator HashMap<TKey, TData, HashFunctor>::Find(const TLookup& key)
+	{
+		MigrateBuckets(MIGRATION_STEP);
 		size_t index;
 		return Find(key, index);
 	}
 
 	template <typename TKey, typename TData, typename HashFunctor>
-	inline typename HashMap<TKey, TData, HashFunctor>::Iterator HashMap<TKey, TData, HashFunctor>::Find(const TKey& key, size_t& index)
+	template <typename TLookup>
+	inline typename HashMap<TKey, TData, HashFunctor>::Iterator HashMap<TKey, TData, HashFunctor>::Find(const TLookup& key, size_t& index)
 	{
-		index = mHashFunction(key) % mBuckets.Size();
-		Iterator iter = end();
+		size_t hash = mHashFunction(key);
+		index = hash % mBuckets.Size();
 		ChainingIterator chain_iter = mBuckets[index].begin();
 
 		for (; chain_iter != mBuckets[index].end(); ++chain_iter)
 		{
 			if ((*chain_iter).first == key)
 			{
-				iter = Iterator(*this, index, chain_iter);
-				break;
+				return Iterator(*this, index, chain_iter);
 			}
 		}
-		return iter;
+
+		//Entries that an incremental rehash hasn't reached yet are still in the old buckets
+		if (IsRehashing())
+		{
+			size_t oldIndex = hash % mOldBuckets.Size();
+			if (oldIndex >= mMigrationIndex)
+			{
+				chain_iter = mOldBuckets[oldIndex].begin();
+				for (; chain_iter != mOldBuckets[oldIndex].end(); ++chain_iter)
+				{
+					if ((*chain_iter).first == key)
+					{
+						index = mBuckets.Size() + oldIndex;
+						return Iterator(*this, index, chain_iter);
+					}
+				}
+			}
+		}
+		return end();
 	}
 
 	template <typename TKey, typename TData, typename HashFunctor>
 	inline typename HashMap<TKey, TData, HashFunctor>::ConstIterator HashMap<TKey, TData, HashFunctor>::Find(const TKey& key) const
 	{
-		size_t index = mHashFunction(key) % mBuckets.Size();
-		ConstIterator iter = end();
+		return FindConst(key);
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	template <typename TLookup, typename Functor, typename>
+	inline typename HashMap<TKey, TData, HashFunctor>::ConstIterator HashMap<TKey, TData, HashFunctor>::Find(const TLookup& key) const
+	{
+		return FindConst(key);
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	template <typename TLookup>
+	inline typename HashMap<TKey, TData, HashFunctor>::ConstIterator HashMap<TKey, TData, HashFunctor>::FindConst(const TLookup& key) const
+	{
+		size_t hash = mHashFunction(key);
+		size_t index = hash % mBuckets.Size();
 		ConstChainingIterator chain_iter = mBuckets[index].begin();
 
 		for (; chain_iter != mBuckets[index].end(); ++chain_iter)
 		{
 			if ((*chain_iter).first == key)
 			{
-				iter = ConstIterator(*this, index, chain_iter);
-				break;
+				return ConstIterator(*this, index, chain_iter);
 			}
 		}
-		return iter;
+
+		if (IsRehashing())
+		{
+			size_t oldIndex = hash % mOldBuckets.Size();
+			if (oldIndex >= mMigrationIndex)
+			{
+				chain_iter = mOldBuckets[oldIndex].begin();
+				for (; chain_iter != mOldBuckets[oldIndex].end(); ++chain_iter)
+				{
+					if ((*chain_iter).first == key)
+					{
+						return ConstIterator(*this, mBuckets.Size() + oldIndex, chain_iter);
+					}
+				}
+			}
+		}
+		return end();
 	}
 
 	template <typename TKey, typename TData, typename HashFunctor>
@@ -96,6 +158,37 @@ namespace Library
 		return iter->second;
 	}
 
+	template <typename TKey, typename TData, typename HashFunctor>
+	template <typename TLookup, typename Functor, typename>
+	inline bool HashMap<TKey, TData, HashFunctor>::ContainsKey(const TLookup& key)
+	{
+		return (Find(key) != end());
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	template <typename TLookup, typename Functor, typename>
+	inline TData& HashMap<TKey, TData, HashFunctor>::At(const TLookup& key)
+	{
+		Iterator iter = Find(key);
+		if (iter == end())
+		{
+			throw std::runtime_error("Provided key is not in the hashmap!");
+		}
+		return iter->second;
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	template <typename TLookup, typename Functor, typename>
+	inline const TData& HashMap<TKey, TData, HashFunctor>::At(const TLookup& key) const
+	{
+		ConstIterator iter = Find(key);
+		if (iter == end())
+		{
+			throw std::runtime_error("Provided key is not in the hashmap!");
+		}
+		return iter->second;
+	}
+
 	template <typename TKey, typename TData, typename HashFunctor>
 	inline size_t HashMap<TKey, TData, HashFunctor>::Size() const
 	{
@@ -105,27 +198,26 @@ namespace Library
 	template <typename TKey, typename TData, typename HashFunctor>
 	inline typename HashMap<TKey, TData, HashFunctor>::Iterator HashMap<TKey, TData, HashFunctor>::Insert(const PairType& pair)
 	{
-		size_t index = mHashFunction(pair.first) % mBuckets.Size();
-		Iterator iter;
-		if (ContainsKey(pair.first, iter))
-		{
-			return iter;
-		}
-		iter = Iterator(*this, index, mBuckets[index].PushBack(pair));
-		mSize++;
-		return iter;
+		bool result;
+		return Insert(pair, result);
 	}
 
 	template <typename TKey, typename TData, typename HashFunctor>
 	inline typename HashMap<TKey, TData, HashFunctor>::Iterator HashMap<TKey, TData, HashFunctor>::Insert(const PairType& pair, bool& result)
 	{
 		result = false;
-		size_t index = mHashFunction(pair.first) % mBuckets.Size();
-		Iterator iter;
-		if (ContainsKey(pair.first, iter))
+		MigrateBuckets(MIGRATION_STEP);
+
+		size_t index;
+		Iterator iter = Find(pair.first, index);
+		if (iter != end())
 		{
 			return iter;
 		}
+
+		//Grow before linking the new entry so the returned iterator stays valid
+		GrowIfNeeded();
+		index = mHashFunction(pair.first) % mBuckets.Size();
 		iter = Iterator(*this, index, mBuckets[index].PushBack(pair));
 		mSize++;
 		result = true;
@@ -154,11 +246,13 @@ namespace Library
 	template <typename TKey, typename TData, typename HashFunctor>
 	inline void HashMap<TKey, TData, HashFunctor>::Remove(const TKey& key)
 	{
+		MigrateBuckets(MIGRATION_STEP);
+
 		size_t index;
 		Iterator iter = Find(key, index);
 		if (iter != end())
 		{
-			mBuckets[index].Remove(iter.mPair);
+			Bucket(index).Remove(iter.mPair);
 			mSize--;
 		}
 	}
@@ -171,18 +265,158 @@ namespace Library
 		{
 			mBuckets[i].Clear();
 		}
+		mOldBuckets.Wipe();
+		mMigrationIndex = 0;
 		mSize = 0;
 	}
 
 	template <typename TKey, typename TData, typename HashFunctor>
 	void HashMap<TKey, TData, HashFunctor>::Rehash(size_t numberOfBuckets)
 	{
-		HashMap new_hashmap(numberOfBuckets);
-		for (Iterator iter = begin(); iter != end(); ++iter)
+		if (numberOfBuckets == 0)
+		{
+			throw std::runtime_error("Number of buckets must be greater than zero!");
+		}
+		FinishRehash();
+
+		BucketType buckets = MakeBuckets(numberOfBuckets);
+		size_t vectorSize = mBuckets.Size();
+		for (size_t i = 0; i < vectorSize; ++i)
+		{
+			ChainType& chain = mBuckets[i];
+			while (!chain.IsEmpty())
+			{
+				chain.MoveFrontTo(buckets[mHashFunction(chain.Front().first) % numberOfBuckets]);
+			}
+		}
+		mBuckets = std::move(buckets);
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline float_t HashMap<TKey, TData, HashFunctor>::MaxLoadFactor() const
+	{
+		return mMaxLoadFactor;
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline void HashMap<TKey, TData, HashFunctor>::SetMaxLoadFactor(float_t maxLoadFactor)
+	{
+		if (maxLoadFactor < 0.0f)
+		{
+			throw std::runtime_error("Max load factor cannot be negative!");
+		}
+		mMaxLoadFactor = maxLoadFactor;
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline bool HashMap<TKey, TData, HashFunctor>::IsIncrementalRehash() const
+	{
+		return mIncrementalRehash;
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline void HashMap<TKey, TData, HashFunctor>::SetIncrementalRehash(bool incremental)
+	{
+		if (!incremental)
+		{
+			FinishRehash();
+		}
+		mIncrementalRehash = incremental;
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline bool HashMap<TKey, TData, HashFunctor>::IsRehashing() const
+	{
+		return !mOldBuckets.IsEmpty();
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline void HashMap<TKey, TData, HashFunctor>::FinishRehash()
+	{
+		MigrateBuckets(mOldBuckets.Size());
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	void HashMap<TKey, TData, HashFunctor>::GrowIfNeeded()
+	{
+		if (mMaxLoadFactor == 0.0f || static_cast<float_t>(mSize + 1) <= mMaxLoadFactor * mBuckets.Size())
+		{
+			return;
+		}
+
+		size_t numberOfBuckets = mBuckets.Size() * 2 + 1;
+		if (mIncrementalRehash)
+		{
+			FinishRehash();
+			mOldBuckets = std::move(mBuckets);
+			mBuckets = MakeBuckets(numberOfBuckets);
+			mMigrationIndex = 0;
+		}
+		else
 		{
-			new_hashmap.Insert(*iter);
+			Rehash(numberOfBuckets);
 		}
-		*this = std::move(new_hashmap);
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	void HashMap<TKey, TData, HashFunctor>::MigrateBuckets(size_t count)
+	{
+		if (!IsRehashing())
+		{
+			return;
+		}
+
+		size_t oldSize = mOldBuckets.Size();
+		for (; count > 0 && mMigrationIndex < oldSize; --count, ++mMigrationIndex)
+		{
+			ChainType& chain = mOldBuckets[mMigrationIndex];
+			while (!chain.IsEmpty())
+			{
+				chain.MoveFrontTo(mBuckets[mHashFunction(chain.Front().first) % mBuckets.Size()]);
+			}
+		}
+
+		if (mMigrationIndex == oldSize)
+		{
+			mOldBuckets.Wipe();
+			mMigrationIndex = 0;
+		}
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline size_t HashMap<TKey, TData, HashFunctor>::BucketCount() const
+	{
+		return mBuckets.Size() + mOldBuckets.Size();
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline typename HashMap<TKey, TData, HashFunctor>::BucketType HashMap<TKey, TData, HashFunctor>::MakeBuckets(size_t numberOfBuckets) const
+	{
+		MemoryResource& resource = Resource();
+		BucketType buckets(resource, numberOfBuckets);
+		for (size_t i = 0; i < numberOfBuckets; ++i)
+		{
+			buckets.EmplaceBack(resource);
+		}
+		return buckets;
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline MemoryResource& HashMap<TKey, TData, HashFunctor>::Resource() const
+	{
+		return mBuckets.Resource();
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline typename HashMap<TKey, TData, HashFunctor>::ChainType& HashMap<TKey, TData, HashFunctor>::Bucket(size_t index)
+	{
+		return (index < mBuckets.Size()) ? mBuckets[index] : mOldBuckets[index - mBuckets.Size()];
+	}
+
+	template <typename TKey, typename TData, typename HashFunctor>
+	inline const typename HashMap<TKey, TData, HashFunctor>::ChainType& HashMap<TKey, TData, HashFunctor>::Bucket(size_t index) const
+	{
+		return (index < mBuckets.Size()) ? mBuckets[index] : mOldBuckets[index - mBuckets.Size()];
 	}
 
 	template <typename TKey, typename TData, typename HashFunctor>
@@ -214,12 +448,12 @@ namespace Library
 	template <typename TKey, typename TData, typename HashFunctor>
 	inline typename HashMap<TKey, TData, HashFunctor>::Iterator HashMap<TKey, TData, HashFunctor>::begin()
 	{
-		size_t vectorSize = mBuckets.Size();
-		for (size_t i = 0; i < vectorSize; ++i)
+		size_t bucketCount = BucketCount();
+		for (size_t i = 0; i < bucketCount; ++i)
 		{
-			if (mBuckets[i].Size() > 0)
+			if (Bucket(i).Size() > 0)
 			{
-				return Iterator(*this, i, mBuckets[i].begin());
+				return Iterator(*this, i, Bucket(i).begin());
 			}
 		}
 		return end();
@@ -228,12 +462,12 @@ namespace Library
 	template <typename TKey, typename TData, typename HashFunctor>
 	inline typename HashMap<TKey, TData, HashFunctor>::ConstIterator HashMap<TKey, TData, HashFunctor>::begin() const
 	{
-		size_t vectorSize = mBuckets.Size();
-		for (size_t i = 0; i < vectorSize; ++i)
+		size_t bucketCount = BucketCount();
+		for (size_t i = 0; i < bucketCount; ++i)
 		{
-			if (mBuckets[i].Size() > 0)
+			if (Bucket(i).Size() > 0)
 			{
-				return ConstIterator(*this, i, mBuckets[i].begin());
+				return ConstIterator(*this, i, Bucket(i).begin());
 			}
 		}
 		return end();
@@ -242,12 +476,12 @@ namespace Library
 	template <typename TKey, typename TData, typename HashFunctor>
 	inline typename HashMap<TKey, TData, HashFunctor>::ConstIterator HashMap<TKey, TData, HashFunctor>::cbegin() const
 	{
-		size_t vectorSize = mBuckets.Size();
-		for (size_t i = 0; i < vectorSize; ++i)
+		size_t bucketCount = BucketCount();
+		for (size_t i = 0; i < bucketCount; ++i)
 		{
-			if (mBuckets[i].Size() > 0)
+			if (Bucket(i).Size() > 0)
 			{
-				return ConstIterator(*this, i, mBuckets[i].begin());
+				return ConstIterator(*this, i, Bucket(i).begin());
 			}
 		}
 		return end();
@@ -256,19 +490,19 @@ namespace Library
 	template <typename TKey, typename TData, typename HashFunctor>
 	inline typename HashMap<TKey, TData, HashFunctor>::Iterator HashMap<TKey, TData, HashFunctor>::end()
 	{
-		return Iterator(*this, mBuckets.Size(), mBuckets[mBuckets.Size() - 1].end());
+		return Iterator(*this, BucketCount(), ChainingIterator());
 	}
 
 	template <typename TKey, typename TData, typename HashFunctor>
 	inline typename HashMap<TKey, TData, HashFunctor>::ConstIterator HashMap<TKey, TData, HashFunctor>::end() const
 	{
-		return ConstIterator(*this, mBuckets.Size(), mBuckets[mBuckets.Size() - 1].end());
+		return ConstIterator(*this, BucketCount(), ConstChainingIterator());
 	}
 
 	template <typename TKey, typename TData, typename HashFunctor>
 	inline typename HashMap<TKey, TData, HashFunctor>::ConstIterator HashMap<TKey, TData, HashFunctor>::cend() const
 	{
-		return ConstIterator(*this, mBuckets.Size(), mBuckets[mBuckets.Size() - 1].end());
+		return ConstIterator(*this, BucketCount(), ConstChainingIterator());
 	}
 
 #pragma endregion
@@ -296,21 +530,22 @@ namespace Library
 
 		mPair++;
 
-		if (mPair == (mOwner->mBuckets[mBucketIndex]).end())
+		if (mPair == mOwner->Bucket(mBucketIndex).end())
 		{
+			size_t bucketCount = mOwner->BucketCount();
 			mBucketIndex++;
-			while ((mBucketIndex < mOwner->mBuckets.Size()) && mOwner->mBuckets[mBucketIndex].IsEmpty())
+			while ((mBucketIndex < bucketCount) && mOwner->Bucket(mBucketIndex).IsEmpty())
 			{
 				mBucketIndex++;
 			}
 
-			if (mBucketIndex < mOwner->mBuckets.Size())
+			if (mBucketIndex < bucketCount)
 			{
-				mPair = mOwner->mBuckets[mBucketIndex].begin();
+				mPair = mOwner->Bucket(mBucketIndex).begin();
 			}
 			else
 			{
-				mPair = mOwner->mBuckets[mBucketIndex - 1].end();
+				mPair = ChainingIterator();
 			}
 		}
 		return *this;
@@ -384,21 +619,22 @@ namespace Library
 
 		mPair++;
 
-		if (mPair == (mOwner->mBuckets[mBucketIndex]).end())
+		if (mPair == mOwner->Bucket(mBucketIndex).end())
 		{
+			size_t bucketCount = mOwner->BucketCount();
 			mBucketIndex++;
-			while ((mBucketIndex < mOwner->mBuckets.Size()) && mOwner->mBuckets[mBucketIndex].isEmpty())
+			while ((mBucketIndex < bucketCount) && mOwner->Bucket(mBucketIndex).IsEmpty())
 			{
 				mBucketIndex++;
 			}
 
-			if (mBucketIndex < mOwner->mBuckets.Size())
+			if (mBucketIndex < bucketCount)
 			{
-				mPair = mOwner->mBuckets[mBucketIndex].begin();
+				mPair = mOwner->Bucket(mBucketIndex).begin();
 			}
 			else
 			{
-				mPair = mOwner->mBuckets[mBucketIndex - 1].end();
+				mPair = ConstChainingIterator();
 			}
 		}
 		return *this;
@@ -407,7 +643,7 @@ namespace Library
 	template <typename TKey, typename TData, typename HashFunctor>
 	inline typename HashMap<TKey, TData, HashFunctor>::ConstIterator HashMap<TKey, TData, HashFunctor>::ConstIterator::operator++(int)
 	{
-		Iterator iter = *this;
+		ConstIterator iter = *this;
 		operator++();
 		return iter;
 	}
@@ -0,0 +1,51 @@
+#include "pch.h"
+#include "InternedString.h"
+#include "FlatHashMap.h"
+
+namespace Library
+{
+	namespace
+	{
+		/// <summary>
+		/// Function-local statics so names can be interned during static initialization of other translation units
+		/// </summary>
+		FlatHashMap<std::string, size_t>& InternTable()
+		{
+			static FlatHashMap<std::string, size_t> table(64);
+			return table;
+		}
+
+		std::mutex& InternMutex()
+		{
+			static std::mutex mutex;
+			return mutex;
+		}
+	}
+
+	InternedString::InternedString() : InternedString(std::string_view())
+	{
+	}
+
+	InternedString::InternedString(std::string_view name)
+	{
+		HashFunctions<std::string> hashFunction;
+		size_t hash = hashFunction(name);
+
+		std::lock_guard<std::mutex> lock(InternMutex());
+		FlatHashMap<std::string, size_t>& table = InternTable();
+		auto iter = table.Find(name);
+		if (iter == table.end())
+		{
+			//FlatHashMap never moves stored pairs, so the key address stays valid for the life of the program
+			iter = table.Insert(std::make_pair(std::string(name), hash));
+		}
+		mString = &(iter->first);
+		mHash = iter->second;
+	}
+
+	size_t InternedString::InternedCount()
+	{
+		std::lock_guard<std::mutex> lock(InternMutex());
+		return InternTable().Size();
+	}
+}
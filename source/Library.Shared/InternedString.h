@@ -0,0 +1,149 @@
+#pragma once
+#include "HashFunctions.h"
+#include <string>
+#include <string_view>
+
+namespace Library
+{
+	/// <summary>
+	/// Immutable name backed by a single shared copy in a global intern table. The hash is computed once when the name
+	/// is interned, so lookups with an InternedString skip hashing, and two InternedStrings compare by address.
+	/// </summary>
+	class InternedString final
+	{
+	public:
+		/// <summary>
+		/// Default constructor, refers to the interned empty string
+		/// </summary>
+		InternedString();
+
+		/// <summary>
+		/// Interns the provided name, reusing the existing entry if the name was interned before
+		/// </summary>
+		/// <param name="name">Name to intern</param>
+		explicit InternedString(std::string_view name);
+
+		/// <summary>
+		/// Default copy constructor
+		/// </summary>
+		/// <param name="rhs">Const reference to InternedString</param>
+		InternedString(const InternedString& rhs) = default;
+
+		/// <summary>
+		/// Default copy assignment operator
+		/// </summary>
+		/// <param name="rhs">Const reference to InternedString</param>
+		/// <returns>Reference to InternedString</returns>
+		InternedString& operator=(const InternedString& rhs) = default;
+
+		/// <summary>
+		/// Default destructor -- interned names live until the program exits
+		/// </summary>
+		~InternedString() = default;
+
+		/// <summary>
+		/// Provides the interned name
+		/// </summary>
+		/// <returns>Const reference to the shared std::string</returns>
+		const std::string& String() const;
+
+		/// <summary>
+		/// Provides the hash of the name, identical to HashFunctions&lt;std::string&gt; for the same characters
+		/// </summary>
+		/// <returns>Precomputed hash</returns>
+		size_t Hash() const;
+
+		/// <summary>
+		/// Comparison operator -- interned names are unique, so this only compares addresses
+		/// </summary>
+		/// <param name="rhs">Const reference to InternedString</param>
+		/// <returns>True if both refer to the same name</returns>
+		bool operator==(const InternedString& rhs) const;
+
+		/// <summary>
+		/// Not equal operator
+		/// </summary>
+		/// <param name="rhs">Const reference to InternedString</param>
+		/// <returns>True if they refer to different names</returns>
+		bool operator!=(const InternedString& rhs) const;
+
+		/// <summary>
+		/// Compares a std::string key (e.g. a Scope entry name) with an interned name. Scope keys are copies of the name,
+		/// so this compares characters; hashed lookups only get here once the stored hashes already match.
+		/// </summary>
+		/// <param name="lhs">Const reference to std::string</param>
+		/// <param name="rhs">Const reference to InternedString</param>
+		/// <returns>True if the characters match</returns>
+		friend bool operator==(const std::string& lhs, const InternedString& rhs);
+		friend bool operator==(const InternedString& lhs, const std::string& rhs);
+		friend bool operator!=(const std::string& lhs, const InternedString& rhs);
+		friend bool operator!=(const InternedString& lhs, const std::string& rhs);
+
+		/// <summary>
+		/// Provides number of distinct names in the intern table
+		/// </summary>
+		/// <returns>Number of interned names</returns>
+		static size_t InternedCount();
+
+	private:
+		const std::string* mString;
+		size_t mHash;
+	};
+
+	template <>
+	class HashFunctions<InternedString>
+	{
+	public:
+		size_t operator()(const InternedString& key) const;
+	};
+
+	inline const std::string& InternedString::String() const
+	{
+		return *mString;
+	}
+
+	inline size_t InternedString::Hash() const
+	{
+		return mHash;
+	}
+
+	inline bool InternedString::operator==(const InternedString& rhs) const
+	{
+		return mString == rhs.mString;
+	}
+
+	inline bool InternedString::operator!=(const InternedString& rhs) const
+	{
+		return mString != rhs.mString;
+	}
+
+	inline bool operator==(const std::string& lhs, const InternedString& rhs)
+	{
+		return (lhs == *rhs.mString);
+	}
+
+	inline bool operator==(const InternedString& lhs, const std::string& rhs)
+	{
+		return (rhs == lhs);
+	}
+
+	inline bool operator!=(const std::string& lhs, const InternedString& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	inline bool operator!=(const InternedString& lhs, const std::string& rhs)
+	{
+		return !(rhs == lhs);
+	}
+
+	inline size_t HashFunctions<InternedString>::operator()(const InternedString& key) const
+	{
+		return key.Hash();
+	}
+
+	inline size_t HashFunctions<std::string>::operator()(const InternedString& key) const
+	{
+		return key.Hash();
+	}
+}
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "JsonTableParseHelper.h"
 #include "Sector.h"
+#include "PrototypeRegistry.h"
 
 namespace Library
 {
@@ -53,7 +54,7 @@ namespace Library
 		IJsonParseHelper::Initialize();
 	}
 
-	bool JsonTableParseHelper::StartHandler(JsonParseMaster::SharedData& data, const std::string& key, const Json::Value& value, bool IsArrayElement, size_t index, size_t /*arraySize*/)
+	bool JsonTableParseHelper::StartHandler(JsonParseMaster::SharedData& data, const std::string& key, const Json::Value& value, bool IsArrayElement, size_t index, size_t arraySize)
 	{
 		JsonTableParseHelper::SharedData* sharedData = data.As<JsonTableParseHelper::SharedData>();
 
@@ -67,8 +68,13 @@ namespace Library
 			assert(mStack.IsEmpty() == false);
 			StackFrame& sf = mStack.Top();
 			sf.type = Datum::StringDatumTypeHashMap.At(value.asString());
-			Datum& datum = sf.scope->Append(sf.key);
-			datum.SetType(sf.type);
+
+			//A prototype definition is handed to the PrototypeRegistry, so it leaves no attribute behind in the parsed scope
+			if (sf.definePrototype.empty())
+			{
+				Datum& datum = sf.scope->Append(sf.key);
+				datum.SetType(sf.type);
+			}
 		}
 		else if (key == "Class")
 		{
@@ -76,21 +82,82 @@ namespace Library
 			StackFrame& sf = mStack.Top();
 			sf.classname = value.asString();
 		}
+		else if (key == "CloneOf")
+		{
+			assert(mStack.IsEmpty() == false);
+			StackFrame& sf = mStack.Top();
+			sf.cloneOf = value.asString();
+		}
+		else if (key == "DefinePrototype")
+		{
+			assert(mStack.IsEmpty() == false);
+			StackFrame& sf = mStack.Top();
+			sf.definePrototype = value.asString();
+		}
 		else if (key == "Value")
 		{
 			assert(mStack.IsEmpty() == false);
 			StackFrame& sf = mStack.Top();
 
+			//The array size is known up front, so reserve it exactly instead of letting the Datum grow one element at a time
+			if (IsArrayElement && index == 0)
+			{
+				Datum* arrayDatum = sf.scope->Find(sf.key);
+				if (arrayDatum != nullptr && !arrayDatum->IsExternal() && arrayDatum->Capacity() < arraySize)
+				{
+					arrayDatum->Reserve(arraySize);
+				}
+			}
+
 			if (sf.type == Datum::DatumType::TABLE)
 			{
-				if (value.size() > 0)
+				//A clone or a prototype is created even without overrides, e.g. { "CloneOf": "Goblin", "Value": {} }
+				if (value.size() > 0 || sf.cloneOf.empty() == false || sf.definePrototype.empty() == false)
 				{
+					//A clone takes the class of its prototype, so a Class next to CloneOf could only be dropped
+					if (sf.cloneOf.empty() == false && sf.classname.empty() == false)
+					{
+						throw std::runtime_error("CloneOf cannot be combined with Class!");
+					}
+
 					Scope* nestedScope;
 					Datum* nestedDatum = sf.scope->Find(sf.key);
 
-					if (nestedDatum != nullptr && nestedDatum->Size() > index)
+					if (sf.definePrototype.empty() == false)
 					{
+						//The registry owns the prototype from the start, the remaining members are parsed straight into it
+						if (sf.cloneOf.empty() == false)
+						{
+							nestedScope = PrototypeRegistry::Instantiate(sf.cloneOf);
+						}
+						else if (sf.classname.empty() == false)
+						{
+							nestedScope = Factory<Scope>::Create(sf.classname);
+							assert(nestedScope != nullptr);
+						}
+						else
+						{
+							nestedScope = new Scope();
+						}
+						PrototypeRegistry::Register(sf.definePrototype, nestedScope);
+					}
+					else if (nestedDatum != nullptr && nestedDatum->Size() > index)
+					{
+						//The existing scope is reused, which only honours the directives it already satisfies
 						nestedScope = &(*nestedDatum)[index];
+						if (sf.cloneOf.empty() == false)
+						{
+							throw std::runtime_error("CloneOf cannot replace a scope that already exists!");
+						}
+						if (sf.classname.empty() == false && nestedScope->Is(sf.classname) == false)
+						{
+							throw std::runtime_error("Class does not match the scope that already exists!");
+						}
+					}
+					else if (sf.cloneOf.empty() == false)
+					{
+						nestedScope = PrototypeRegistry::Instantiate(sf.cloneOf);
+						sf.scope->Adopt(*nestedScope, sf.key);
 					}
 					else if (sf.classname.empty() == false)
 					{
@@ -103,6 +170,10 @@ namespace Library
 						nestedScope = &(sf.scope->AppendScope(sf.key));
 					}
 
+					//Array elements share the frame, so the next element must not inherit these
+					sf.cloneOf.clear();
+					sf.definePrototype.clear();
+
 					if (IsArrayElement)
 					{
 						mStack.Push({ key,"", Datum::DatumType::TABLE, nestedScope });
@@ -6,7 +6,11 @@
 namespace Library
 {
 	/// <summary>
-	/// Table Parse Helper Class - Parses Scopes and Attributed Objects stored as JSON Data
+	/// Table Parse Helper Class - Parses Scopes and Attributed Objects stored as JSON Data. Besides "Type", "Class" and
+	/// "Value", a table may carry "DefinePrototype": "name", which registers it with the PrototypeRegistry instead of
+	/// adding it to the parsed scope, and "CloneOf": "name", which instantiates it from a registered prototype and
+	/// applies its "Value" members as overrides. A prototype must be registered before it is cloned; jsoncpp visits
+	/// keys alphabetically, so prototypes are best declared in their own file.
 	/// </summary>
 	class JsonTableParseHelper final : public IJsonParseHelper
 	{
@@ -144,6 +148,8 @@ namespace Library
 			std::string classname;
 			Datum::DatumType type = Datum::DatumType::UNKNOWN;
 			Scope* scope = nullptr;
+			std::string cloneOf;
+			std::string definePrototype;
 		};
 
 		Stack<StackFrame> mStack;
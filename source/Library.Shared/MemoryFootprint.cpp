@@ -0,0 +1,50 @@
+#include "pch.h"
+#include "MemoryFootprint.h"
+#include <functional>
+
+namespace Library
+{
+	size_t MemoryFootprint::Used() const
+	{
+		return HashMapSlots + HashMapEntries + VectorElements + DatumElements + Strings;
+	}
+
+	size_t MemoryFootprint::Slack() const
+	{
+		return HashMapSlotSlack + HashMapEntrySlack + VectorSlack + DatumSlack;
+	}
+
+	size_t MemoryFootprint::Total() const
+	{
+		return Used() + Slack() + DatumShared;
+	}
+
+	MemoryFootprint& MemoryFootprint::operator+=(const MemoryFootprint& rhs)
+	{
+		HashMapSlots += rhs.HashMapSlots;
+		HashMapSlotSlack += rhs.HashMapSlotSlack;
+		HashMapEntries += rhs.HashMapEntries;
+		HashMapEntrySlack += rhs.HashMapEntrySlack;
+		VectorElements += rhs.VectorElements;
+		VectorSlack += rhs.VectorSlack;
+		DatumElements += rhs.DatumElements;
+		DatumSlack += rhs.DatumSlack;
+		DatumShared += rhs.DatumShared;
+		Strings += rhs.Strings;
+		Scopes += rhs.Scopes;
+		return *this;
+	}
+
+	size_t MemoryFootprint::HeapBytes(const std::string& string)
+	{
+		//A string in its small string buffer points into itself
+		const char* first = reinterpret_cast<const char*>(&string);
+		const char* data = string.data();
+		std::less<const char*> less;
+		if (!less(data, first) && less(data, first + sizeof(std::string)))
+		{
+			return 0;
+		}
+		return string.capacity() + 1;
+	}
+}
@@ -0,0 +1,100 @@
+#pragma once
+#include <cstddef>
+#include <string>
+
+namespace Library
+{
+	/// <summary>
+	/// Heap bytes held by a container or a Scope tree, split into what the contents need and what is allocated but
+	/// unused. Slack is what a ShrinkToFit/Compact pass can hand back.
+	/// </summary>
+	struct MemoryFootprint final
+	{
+		/// <summary>
+		/// Hashmap slots holding an entry
+		/// </summary>
+		size_t HashMapSlots = 0;
+
+		/// <summary>
+		/// Empty hashmap slots
+		/// </summary>
+		size_t HashMapSlotSlack = 0;
+
+		/// <summary>
+		/// Hashmap entry nodes holding a key/value pair, the pair itself included
+		/// </summary>
+		size_t HashMapEntries = 0;
+
+		/// <summary>
+		/// Hashmap entry nodes that are free or not handed out yet
+		/// </summary>
+		size_t HashMapEntrySlack = 0;
+
+		/// <summary>
+		/// Vector elements
+		/// </summary>
+		size_t VectorElements = 0;
+
+		/// <summary>
+		/// Vector capacity past the size
+		/// </summary>
+		size_t VectorSlack = 0;
+
+		/// <summary>
+		/// Datum elements on the heap. Inline elements live inside the Datum and external ones belong to their owner.
+		/// </summary>
+		size_t DatumElements = 0;
+
+		/// <summary>
+		/// Datum heap capacity past the size
+		/// </summary>
+		size_t DatumSlack = 0;
+
+		/// <summary>
+		/// Datum buffers shared copy-on-write with another Datum, counted in full by every Datum sharing them
+		/// </summary>
+		size_t DatumShared = 0;
+
+		/// <summary>
+		/// Characters of std::strings too long for their small string buffer, keys included
+		/// </summary>
+		size_t Strings = 0;
+
+		/// <summary>
+		/// Number of scopes in the tree (a count, not bytes)
+		/// </summary>
+		size_t Scopes = 0;
+
+		/// <summary>
+		/// Bytes the contents need
+		/// </summary>
+		/// <returns>Sum of the element categories</returns>
+		size_t Used() const;
+
+		/// <summary>
+		/// Bytes allocated but unused
+		/// </summary>
+		/// <returns>Sum of the slack categories</returns>
+		size_t Slack() const;
+
+		/// <summary>
+		/// Every byte accounted for, used, slack and shared
+		/// </summary>
+		/// <returns>Total bytes</returns>
+		size_t Total() const;
+
+		/// <summary>
+		/// Adds the categories of another footprint to this one
+		/// </summary>
+		/// <param name="rhs">Footprint to add</param>
+		/// <returns>Reference to this footprint</returns>
+		MemoryFootprint& operator+=(const MemoryFootprint& rhs);
+
+		/// <summary>
+		/// Provides the heap bytes of a string, zero when it fits in its small string buffer
+		/// </summary>
+		/// <param name="string">String to measure</param>
+		/// <returns>Heap bytes, terminator included</returns>
+		static size_t HeapBytes(const std::string& string);
+	};
+}
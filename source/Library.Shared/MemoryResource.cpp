@@ -0,0 +1,80 @@
+#include "pch.h"
+#include "MemoryResource.h"
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace Library
+{
+	namespace
+	{
+		class HeapResource final : public MemoryResource
+		{
+		public:
+			void* Allocate(size_t bytes) override
+			{
+				void* pointer = malloc(bytes);
+				if (pointer == nullptr && bytes > 0)
+				{
+					throw std::bad_alloc();
+				}
+				return pointer;
+			}
+
+			void Deallocate(void* pointer, size_t) override
+			{
+				free(pointer);
+			}
+
+			void* Reallocate(void* pointer, size_t, size_t newBytes) override
+			{
+				void* resized = realloc(pointer, newBytes);
+				if (resized == nullptr && newBytes > 0)
+				{
+					throw std::bad_alloc();
+				}
+				return resized;
+			}
+		};
+
+		thread_local MemoryResource* sDefaultResource = nullptr;
+	}
+
+	void* MemoryResource::Reallocate(void* pointer, size_t oldBytes, size_t newBytes)
+	{
+		void* resized = Allocate(newBytes);
+		if (pointer != nullptr)
+		{
+			memcpy(resized, pointer, (oldBytes < newBytes ? oldBytes : newBytes));
+			Deallocate(pointer, oldBytes);
+		}
+		return resized;
+	}
+
+	MemoryResource& MemoryResource::Heap()
+	{
+		static HeapResource heap;
+		return heap;
+	}
+
+	MemoryResource& MemoryResource::Default()
+	{
+		return (sDefaultResource != nullptr ? *sDefaultResource : Heap());
+	}
+
+	MemoryResource& MemoryResource::SetDefault(MemoryResource& resource)
+	{
+		MemoryResource& previous = Default();
+		sDefaultResource = &resource;
+		return previous;
+	}
+
+	DefaultResourceGuard::DefaultResourceGuard(MemoryResource& resource) : mPrevious(MemoryResource::SetDefault(resource))
+	{
+	}
+
+	DefaultResourceGuard::~DefaultResourceGuard()
+	{
+		MemoryResource::SetDefault(mPrevious);
+	}
+}
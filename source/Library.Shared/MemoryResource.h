@@ -0,0 +1,89 @@
+#pragma once
+#include <cstddef>
+
+namespace Library
+{
+	/// <summary>
+	/// Polymorphic source of raw memory for Vector, SList, HashMap, FlatHashMap and Datum. Every block is aligned to
+	/// MemoryResource::ALIGNMENT. Containers capture MemoryResource::Default() when they are constructed or copied,
+	/// unless a resource is passed explicitly, keep it when they are moved, and return every block to the resource that handed it out.
+	/// </summary>
+	class MemoryResource
+	{
+	public:
+		static const size_t ALIGNMENT = alignof(std::max_align_t);
+
+		MemoryResource() = default;
+		MemoryResource(const MemoryResource&) = delete;
+		MemoryResource& operator=(const MemoryResource&) = delete;
+		MemoryResource(MemoryResource&&) = delete;
+		MemoryResource& operator=(MemoryResource&&) = delete;
+		virtual ~MemoryResource() = default;
+
+		/// <summary>
+		/// Allocates a block of memory
+		/// </summary>
+		/// <param name="bytes">Size of the block</param>
+		/// <returns>Pointer to the block</returns>
+		virtual void* Allocate(size_t bytes) = 0;
+
+		/// <summary>
+		/// Returns a block to the resource. Passing nullptr does nothing.
+		/// </summary>
+		/// <param name="pointer">Pointer returned by Allocate or Reallocate</param>
+		/// <param name="bytes">Size the block was allocated with</param>
+		virtual void Deallocate(void* pointer, size_t bytes) = 0;
+
+		/// <summary>
+		/// Grows or shrinks a block, keeping its first min(oldBytes, newBytes) bytes. The default implementation
+		/// allocates a new block, copies the contents and deallocates the old one.
+		/// </summary>
+		/// <param name="pointer">Pointer to the block, or nullptr to allocate a new one</param>
+		/// <param name="oldBytes">Current size of the block</param>
+		/// <param name="newBytes">Requested size of the block</param>
+		/// <returns>Pointer to the resized block</returns>
+		virtual void* Reallocate(void* pointer, size_t oldBytes, size_t newBytes);
+
+		/// <summary>
+		/// Resource backed by malloc, realloc and free
+		/// </summary>
+		/// <returns>Reference to the heap resource</returns>
+		static MemoryResource& Heap();
+
+		/// <summary>
+		/// Resource used by containers constructed on the calling thread without an explicit resource
+		/// </summary>
+		/// <returns>Reference to the default resource, the heap unless SetDefault was called</returns>
+		static MemoryResource& Default();
+
+		/// <summary>
+		/// Replaces the default resource of the calling thread
+		/// </summary>
+		/// <param name="resource">New default resource</param>
+		/// <returns>Reference to the previous default resource</returns>
+		static MemoryResource& SetDefault(MemoryResource& resource);
+	};
+
+	/// <summary>
+	/// Makes a resource the default for the calling thread while the guard is alive, e.g. while a World is parsed from JSON
+	/// </summary>
+	class DefaultResourceGuard final
+	{
+	public:
+		/// <summary>
+		/// Installs the resource as the default
+		/// </summary>
+		/// <param name="resource">Resource to install</param>
+		explicit DefaultResourceGuard(MemoryResource& resource);
+		DefaultResourceGuard(const DefaultResourceGuard&) = delete;
+		DefaultResourceGuard& operator=(const DefaultResourceGuard&) = delete;
+
+		/// <summary>
+		/// Restores the previous default resource
+		/// </summary>
+		~DefaultResourceGuard();
+
+	private:
+		MemoryResource& mPrevious;
+	};
+}
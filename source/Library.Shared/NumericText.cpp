@@ -0,0 +1,178 @@
+#include "pch.h"
+#include "NumericText.h"
+#include <charconv>
+
+namespace Library
+{
+	namespace
+	{
+		const char* SkipWhitespace(const char* first, const char* last)
+		{
+			while (first != last && (*first == ' ' || *first == '\t' || *first == '\n' || *first == '\r'))
+			{
+				++first;
+			}
+			return first;
+		}
+
+		bool Expect(const char*& first, const char* last, std::string_view token)
+		{
+			first = SkipWhitespace(first, last);
+			if (static_cast<size_t>(last - first) < token.size() || std::string_view(first, token.size()) != token)
+			{
+				return false;
+			}
+			first += token.size();
+			return true;
+		}
+
+		template <typename T>
+		bool ReadNumber(const char*& first, const char* last, T& value)
+		{
+			//from_chars takes no plus sign, the stream and scanf parsing it replaces did
+			first = SkipWhitespace(first, last);
+			if (first != last && *first == '+')
+			{
+				++first;
+			}
+			auto [end, error] = std::from_chars(first, last, value);
+			if (error != std::errc())
+			{
+				return false;
+			}
+			first = end;
+			return true;
+		}
+
+		bool ReadFloats(const char*& first, const char* last, float* values, size_t count)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				if ((i > 0 && !Expect(first, last, ",")) || !ReadNumber(first, last, values[i]))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		char* WriteFloat(char* first, float value)
+		{
+			return std::to_chars(first, first + NumericText::MaxFloatLength, value).ptr;
+		}
+
+		char* WriteFloats(char* first, const float* values, size_t count)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				if (i > 0)
+				{
+					*first++ = ',';
+					*first++ = ' ';
+				}
+				first = WriteFloat(first, values[i]);
+			}
+			return first;
+		}
+	}
+
+	bool NumericText::Parse(std::string_view text, std::int32_t& value)
+	{
+		const char* first = text.data();
+		return ReadNumber(first, text.data() + text.size(), value);
+	}
+
+	bool NumericText::Parse(std::string_view text, float& value)
+	{
+		const char* first = text.data();
+		return ReadNumber(first, text.data() + text.size(), value);
+	}
+
+	bool NumericText::Parse(std::string_view text, glm::vec4& value)
+	{
+		const char* first = text.data();
+		const char* last = first + text.size();
+		float values[4];
+		if (!Expect(first, last, "vec4") || !Expect(first, last, "(") || !ReadFloats(first, last, values, 4) || !Expect(first, last, ")"))
+		{
+			return false;
+		}
+		value = glm::vec4(values[0], values[1], values[2], values[3]);
+		return true;
+	}
+
+	bool NumericText::Parse(std::string_view text, glm::mat4& value)
+	{
+		const char* first = text.data();
+		const char* last = first + text.size();
+		glm::mat4 matrix;
+		if (!Expect(first, last, "mat4x4") || !Expect(first, last, "("))
+		{
+			return false;
+		}
+		for (int column = 0; column < 4; ++column)
+		{
+			if ((column > 0 && !Expect(first, last, ",")) || !Expect(first, last, "(") || !ReadFloats(first, last, &matrix[column][0], 4) || !Expect(first, last, ")"))
+			{
+				return false;
+			}
+		}
+		if (!Expect(first, last, ")"))
+		{
+			return false;
+		}
+		value = matrix;
+		return true;
+	}
+
+	std::string NumericText::Format(std::int32_t value)
+	{
+		char buffer[16];
+		char* end = std::to_chars(buffer, buffer + sizeof(buffer), value).ptr;
+		return std::string(buffer, end);
+	}
+
+	std::string NumericText::Format(float value)
+	{
+		char buffer[MaxFloatLength];
+		char* end = WriteFloat(buffer, value);
+		return std::string(buffer, end);
+	}
+
+	std::string NumericText::Format(const glm::vec4& value)
+	{
+		//Everything is written into one stack buffer, the returned string is the only allocation
+		char buffer[sizeof("vec4()") + 4 * (MaxFloatLength + 2)];
+		char* end = buffer;
+		for (char c : std::string_view("vec4("))
+		{
+			*end++ = c;
+		}
+		end = WriteFloats(end, &value[0], 4);
+		*end++ = ')';
+		return std::string(buffer, end);
+	}
+
+	std::string NumericText::Format(const glm::mat4& value)
+	{
+		char buffer[sizeof("mat4x4()") + 4 * (4 * (MaxFloatLength + 2) + 4)];
+		char* end = buffer;
+		for (char c : std::string_view("mat4x4("))
+		{
+			*end++ = c;
+		}
+		for (int column = 0; column < 4; ++column)
+		{
+			if (column > 0)
+			{
+				*end++ = ',';
+				*end++ = ' ';
+			}
+			*end++ = '(';
+			end = WriteFloats(end, &value[column][0], 4);
+			*end++ = ')';
+		}
+		*end++ = ')';
+		return std::string(buffer, end);
+	}
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <glm/glm.hpp>
+
+namespace Library
+{
+	/// <summary>
+	/// Locale-free conversions between numbers and the text Datum reads and writes, built on std::from_chars and
+	/// std::to_chars. Floats are written in their shortest form that parses back to the same value, so formatting then
+	/// parsing round-trips exactly. Vectors and matrices use the layout of glm::to_string, "vec4(x, y, z, w)" and
+	/// "mat4x4((...), (...), (...), (...))" with one parenthesized group per column.
+	/// </summary>
+	class NumericText final
+	{
+	public:
+		NumericText() = delete;
+		NumericText(const NumericText& rhs) = delete;
+		NumericText(NumericText&& rhs) = delete;
+		NumericText& operator=(const NumericText& rhs) = delete;
+		NumericText& operator=(NumericText&& rhs) = delete;
+
+		/// <summary>
+		/// Parses an integer. Leading whitespace and a plus sign are skipped, text after the number is ignored.
+		/// </summary>
+		/// <param name="text">Text to parse</param>
+		/// <param name="value">Receives the integer, untouched on failure</param>
+		/// <returns>True if the text starts with an integer in range</returns>
+		static bool Parse(std::string_view text, std::int32_t& value);
+
+		/// <summary>
+		/// Parses a float in fixed or scientific notation. Leading whitespace and a plus sign are skipped, text after the
+		/// number is ignored.
+		/// </summary>
+		/// <param name="text">Text to parse</param>
+		/// <param name="value">Receives the float, untouched on failure</param>
+		/// <returns>True if the text starts with a float in range</returns>
+		static bool Parse(std::string_view text, float& value);
+
+		/// <summary>
+		/// Parses "vec4(x, y, z, w)", whitespace between the tokens is optional
+		/// </summary>
+		/// <param name="text">Text to parse</param>
+		/// <param name="value">Receives the vector, untouched on failure</param>
+		/// <returns>True if the text is a well formed vector</returns>
+		static bool Parse(std::string_view text, glm::vec4& value);
+
+		/// <summary>
+		/// Parses "mat4x4((...), (...), (...), (...))", one group of four floats per column
+		/// </summary>
+		/// <param name="text">Text to parse</param>
+		/// <param name="value">Receives the matrix, untouched on failure</param>
+		/// <returns>True if the text is a well formed matrix</returns>
+		static bool Parse(std::string_view text, glm::mat4& value);
+
+		/// <summary>
+		/// Formats an integer
+		/// </summary>
+		/// <param name="value">Integer to format</param>
+		/// <returns>Decimal text</returns>
+		static std::string Format(std::int32_t value);
+
+		/// <summary>
+		/// Formats a float in the shortest form that parses back to the same value
+		/// </summary>
+		/// <param name="value">Float to format</param>
+		/// <returns>Decimal text</returns>
+		static std::string Format(float value);
+
+		/// <summary>
+		/// Formats a vector as "vec4(x, y, z, w)"
+		/// </summary>
+		/// <param name="value">Vector to format</param>
+		/// <returns>Text of the vector</returns>
+		static std::string Format(const glm::vec4& value);
+
+		/// <summary>
+		/// Formats a matrix as "mat4x4((...), (...), (...), (...))", one group per column
+		/// </summary>
+		/// <param name="value">Matrix to format</param>
+		/// <returns>Text of the matrix</returns>
+		static std::string Format(const glm::mat4& value);
+
+		/// <summary>
+		/// Longest text Format writes for a float, e.g. "-1.17549435e-38"
+		/// </summary>
+		static const size_t MaxFloatLength = 16;
+	};
+}
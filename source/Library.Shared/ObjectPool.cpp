@@ -0,0 +1,122 @@
+#include "pch.h"
+#include "ObjectPool.h"
+#include "PoolResource.h"
+#include <array>
+#include <utility>
+
+namespace Library
+{
+	namespace
+	{
+		const size_t SizeClassCount = ObjectPool::MAX_POOLED_SIZE / MemoryResource::ALIGNMENT;
+
+		struct SizeClass final
+		{
+			explicit SizeClass(size_t blockSize) :
+				Pool(blockSize, ObjectPool::BLOCKS_PER_CHUNK)
+			{
+			}
+
+			PoolResource Pool;
+			ObjectPool::Statistics Stats;
+			std::mutex Mutex;
+		};
+
+		template <size_t... Indices>
+		std::array<SizeClass, sizeof...(Indices)> MakeSizeClasses(std::index_sequence<Indices...>)
+		{
+			return { SizeClass((Indices + 1) * MemoryResource::ALIGNMENT)... };
+		}
+
+		//No memory is requested until the first allocation, so the table can live in static storage
+		std::array<SizeClass, SizeClassCount>& SizeClasses()
+		{
+			static std::array<SizeClass, SizeClassCount> sizeClasses = MakeSizeClasses(std::make_index_sequence<SizeClassCount>());
+			return sizeClasses;
+		}
+
+		size_t SizeClassIndex(size_t bytes)
+		{
+			return (bytes == 0 ? 0 : (bytes - 1) / MemoryResource::ALIGNMENT);
+		}
+	}
+
+	void* ObjectPool::Allocate(size_t bytes)
+	{
+		if (bytes > MAX_POOLED_SIZE)
+		{
+			return MemoryResource::Heap().Allocate(bytes);
+		}
+
+		SizeClass& sizeClass = SizeClasses()[SizeClassIndex(bytes)];
+		std::lock_guard<std::mutex> lock(sizeClass.Mutex);
+		if (sizeClass.Stats.InUse == sizeClass.Pool.BlocksReserved())
+		{
+			++sizeClass.Stats.ChunkAllocations;
+		}
+		void* block = sizeClass.Pool.Allocate(bytes);
+		++sizeClass.Stats.Allocations;
+		++sizeClass.Stats.InUse;
+		return block;
+	}
+
+	void ObjectPool::Deallocate(void* pointer, size_t bytes)
+	{
+		if (pointer == nullptr)
+		{
+			return;
+		}
+		if (bytes > MAX_POOLED_SIZE)
+		{
+			MemoryResource::Heap().Deallocate(pointer, bytes);
+			return;
+		}
+
+		SizeClass& sizeClass = SizeClasses()[SizeClassIndex(bytes)];
+		std::lock_guard<std::mutex> lock(sizeClass.Mutex);
+		sizeClass.Pool.Deallocate(pointer, bytes);
+		++sizeClass.Stats.Deallocations;
+		--sizeClass.Stats.InUse;
+	}
+
+	void ObjectPool::Trim()
+	{
+		for (SizeClass& sizeClass : SizeClasses())
+		{
+			std::lock_guard<std::mutex> lock(sizeClass.Mutex);
+			if (sizeClass.Stats.InUse == 0)
+			{
+				sizeClass.Pool.Release();
+			}
+		}
+	}
+
+	ObjectPool::Statistics ObjectPool::GetStatistics(size_t bytes)
+	{
+		if (bytes > MAX_POOLED_SIZE)
+		{
+			return Statistics();
+		}
+
+		SizeClass& sizeClass = SizeClasses()[SizeClassIndex(bytes)];
+		std::lock_guard<std::mutex> lock(sizeClass.Mutex);
+		Statistics statistics = sizeClass.Stats;
+		statistics.BlocksReserved = sizeClass.Pool.BlocksReserved();
+		return statistics;
+	}
+
+	ObjectPool::Statistics ObjectPool::GetTotalStatistics()
+	{
+		Statistics total;
+		for (SizeClass& sizeClass : SizeClasses())
+		{
+			std::lock_guard<std::mutex> lock(sizeClass.Mutex);
+			total.Allocations += sizeClass.Stats.Allocations;
+			total.Deallocations += sizeClass.Stats.Deallocations;
+			total.InUse += sizeClass.Stats.InUse;
+			total.ChunkAllocations += sizeClass.Stats.ChunkAllocations;
+			total.BlocksReserved += sizeClass.Pool.BlocksReserved();
+		}
+		return total;
+	}
+}
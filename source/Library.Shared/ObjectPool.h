@@ -0,0 +1,80 @@
+#pragma once
+#include <cstddef>
+
+namespace Library
+{
+	/// <summary>
+	/// Slab allocator for Scope and every type derived from it. Objects are binned by size into classes of
+	/// MemoryResource::ALIGNMENT bytes, each backed by its own PoolResource, so all instances of a type share a free list
+	/// and a destroyed Entity's block is handed to the next Entity created. Objects larger than MAX_POOLED_SIZE go to the heap.
+	/// A size class keeps its chunks after its last object is destroyed, so creating and destroying a single object (e.g. a
+	/// temporary Clone) never touches the heap; Trim hands the memory back. Thread safe: each size class has its own
+	/// mutex, so the cost in the single-threaded engine is one uncontended lock per allocation.
+	/// </summary>
+	class ObjectPool final
+	{
+	public:
+		static const size_t MAX_POOLED_SIZE = 1024;
+		static const size_t BLOCKS_PER_CHUNK = 32;
+
+		/// <summary>
+		/// Allocation counters of a size class, or of all of them
+		/// </summary>
+		struct Statistics final
+		{
+			size_t Allocations = 0;
+			size_t Deallocations = 0;
+			size_t InUse = 0;
+			size_t ChunkAllocations = 0;
+			size_t BlocksReserved = 0;
+		};
+
+		ObjectPool() = delete;
+		ObjectPool(const ObjectPool& rhs) = delete;
+		ObjectPool(ObjectPool&& rhs) = delete;
+		ObjectPool& operator=(const ObjectPool& rhs) = delete;
+		ObjectPool& operator=(ObjectPool&& rhs) = delete;
+
+		/// <summary>
+		/// Allocates a block from the size class of the object
+		/// </summary>
+		/// <param name="bytes">Size of the object</param>
+		/// <returns>Pointer to the block</returns>
+		static void* Allocate(size_t bytes);
+
+		/// <summary>
+		/// Returns a block to its size class. Passing nullptr does nothing.
+		/// </summary>
+		/// <param name="pointer">Pointer returned by Allocate</param>
+		/// <param name="bytes">Size the block was allocated with</param>
+		static void Deallocate(void* pointer, size_t bytes);
+
+		/// <summary>
+		/// Returns the chunks of every size class with no objects in use to the heap, e.g. after unloading a level
+		/// </summary>
+		static void Trim();
+
+		/// <summary>
+		/// Provides the counters of the size class an object of the given size falls in. Types of similar size share a class.
+		/// </summary>
+		/// <param name="bytes">Size of the object</param>
+		/// <returns>Copy of the counters, all zero for sizes that are not pooled</returns>
+		static Statistics GetStatistics(size_t bytes);
+
+		/// <summary>
+		/// Provides the counters of the size class type T falls in
+		/// </summary>
+		/// <returns>Copy of the counters</returns>
+		template <typename T>
+		static Statistics GetStatistics()
+		{
+			return GetStatistics(sizeof(T));
+		}
+
+		/// <summary>
+		/// Provides the counters summed over every size class
+		/// </summary>
+		/// <returns>Copy of the counters</returns>
+		static Statistics GetTotalStatistics();
+	};
+}
@@ -0,0 +1,115 @@
+#include "pch.h"
+#include "PoolResource.h"
+
+namespace Library
+{
+	PoolResource::PoolResource(size_t blockSize, size_t blocksPerChunk, MemoryResource& upstream) :
+		mUpstream(upstream), mBlockSize((blockSize < sizeof(FreeBlock) ? sizeof(FreeBlock) : blockSize)), mBlocksPerChunk(blocksPerChunk)
+	{
+		if (blockSize == 0 || blocksPerChunk == 0)
+		{
+			throw std::runtime_error("Pool block size and blocks per chunk must be greater than 0!");
+		}
+		mBlockSize = (mBlockSize + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+	}
+
+	PoolResource::~PoolResource()
+	{
+		Release();
+	}
+
+	void* PoolResource::Allocate(size_t bytes)
+	{
+		if (bytes > mBlockSize)
+		{
+			return mUpstream.Allocate(bytes);
+		}
+
+		if (mFreeList == nullptr)
+		{
+			AllocateChunk();
+		}
+
+		FreeBlock* block = mFreeList;
+		mFreeList = block->Next;
+		++mBlocksInUse;
+		return block;
+	}
+
+	void PoolResource::Deallocate(void* pointer, size_t bytes)
+	{
+		if (pointer == nullptr)
+		{
+			return;
+		}
+		if (bytes > mBlockSize)
+		{
+			mUpstream.Deallocate(pointer, bytes);
+			return;
+		}
+
+		FreeBlock* block = static_cast<FreeBlock*>(pointer);
+		block->Next = mFreeList;
+		mFreeList = block;
+		--mBlocksInUse;
+	}
+
+	void* PoolResource::Reallocate(void* pointer, size_t oldBytes, size_t newBytes)
+	{
+		if (pointer != nullptr && oldBytes <= mBlockSize && newBytes <= mBlockSize)
+		{
+			return pointer;
+		}
+		if (pointer != nullptr && oldBytes > mBlockSize && newBytes > mBlockSize)
+		{
+			return mUpstream.Reallocate(pointer, oldBytes, newBytes);
+		}
+		return MemoryResource::Reallocate(pointer, oldBytes, newBytes);
+	}
+
+	void PoolResource::Release()
+	{
+		size_t chunkBytes = ALIGNMENT + mBlockSize * mBlocksPerChunk;
+		while (mChunks != nullptr)
+		{
+			Chunk* next = mChunks->Next;
+			mUpstream.Deallocate(mChunks, chunkBytes);
+			mChunks = next;
+		}
+		mFreeList = nullptr;
+		mBlocksInUse = 0;
+		mBlocksReserved = 0;
+	}
+
+	size_t PoolResource::BlockSize() const
+	{
+		return mBlockSize;
+	}
+
+	size_t PoolResource::BlocksInUse() const
+	{
+		return mBlocksInUse;
+	}
+
+	size_t PoolResource::BlocksReserved() const
+	{
+		return mBlocksReserved;
+	}
+
+	void PoolResource::AllocateChunk()
+	{
+		//The chunk header takes one alignment unit, the blocks follow it and are threaded onto the free list
+		Chunk* chunk = static_cast<Chunk*>(mUpstream.Allocate(ALIGNMENT + mBlockSize * mBlocksPerChunk));
+		chunk->Next = mChunks;
+		mChunks = chunk;
+		mBlocksReserved += mBlocksPerChunk;
+
+		std::byte* blocks = reinterpret_cast<std::byte*>(chunk) + ALIGNMENT;
+		for (size_t i = mBlocksPerChunk; i > 0; --i)
+		{
+			FreeBlock* block = reinterpret_cast<FreeBlock*>(blocks + (i - 1) * mBlockSize);
+			block->Next = mFreeList;
+			mFreeList = block;
+		}
+	}
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include "MemoryResource.h"
+
+namespace Library
+{
+	/// <summary>
+	/// Fixed-size block allocator. Requests up to the block size are served from a free list refilled a chunk at a time,
+	/// larger requests are forwarded to the upstream resource. Suited to node-based containers such as SList and HashMap,
+	/// whose allocations all have the same size. Not thread safe.
+	/// </summary>
+	class PoolResource final : public MemoryResource
+	{
+	public:
+		static const size_t DEFAULT_BLOCKS_PER_CHUNK = 64;
+
+		/// <summary>
+		/// Constructor, no memory is requested until the first allocation
+		/// </summary>
+		/// <param name="blockSize">Size of every block handed out by the pool</param>
+		/// <param name="blocksPerChunk">Number of blocks requested from upstream at a time</param>
+		/// <param name="upstream">Resource the chunks and oversized blocks are allocated from</param>
+		explicit PoolResource(size_t blockSize, size_t blocksPerChunk = DEFAULT_BLOCKS_PER_CHUNK, MemoryResource& upstream = MemoryResource::Heap());
+
+		/// <summary>
+		/// Destructor, releases every chunk
+		/// </summary>
+		~PoolResource();
+
+		void* Allocate(size_t bytes) override;
+		void Deallocate(void* pointer, size_t bytes) override;
+		void* Reallocate(void* pointer, size_t oldBytes, size_t newBytes) override;
+
+		/// <summary>
+		/// Returns every chunk to the upstream resource. Every pooled block handed out so far becomes invalid;
+		/// oversized blocks are unaffected and must still be deallocated.
+		/// </summary>
+		void Release();
+
+		/// <summary>
+		/// Provides the size of the pooled blocks (the requested size rounded up to the alignment)
+		/// </summary>
+		/// <returns>Block size</returns>
+		size_t BlockSize() const;
+
+		/// <summary>
+		/// Provides number of pooled blocks currently handed out
+		/// </summary>
+		/// <returns>Number of blocks in use</returns>
+		size_t BlocksInUse() const;
+
+		/// <summary>
+		/// Provides number of pooled blocks in the chunks requested so far, in use or free
+		/// </summary>
+		/// <returns>Number of blocks reserved</returns>
+		size_t BlocksReserved() const;
+
+	private:
+		struct FreeBlock final
+		{
+			FreeBlock* Next;
+		};
+
+		struct Chunk final
+		{
+			Chunk* Next;
+		};
+
+		void AllocateChunk();
+
+		MemoryResource& mUpstream;
+		size_t mBlockSize;
+		size_t mBlocksPerChunk;
+		Chunk* mChunks = nullptr;
+		FreeBlock* mFreeList = nullptr;
+		size_t mBlocksInUse = 0;
+		size_t mBlocksReserved = 0;
+	};
+}
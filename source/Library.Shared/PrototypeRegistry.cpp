@@ -0,0 +1,90 @@
+#include "pch.h"
+#include "PrototypeRegistry.h"
+
+namespace Library
+{
+	PrototypeRegistry::PrototypeTable PrototypeRegistry::mPrototypes;
+
+	PrototypeRegistry::PrototypeTable::PrototypeTable()
+	{
+		//Prototypes go back to ObjectPool when the table is destroyed, so the pool is created first to be destroyed last
+		ObjectPool::GetTotalStatistics();
+	}
+
+	PrototypeRegistry::PrototypeTable::~PrototypeTable()
+	{
+		for (auto& pair : Prototypes)
+		{
+			delete pair.second;
+		}
+	}
+
+	void PrototypeRegistry::Register(const std::string& name, gsl::owner<Scope*> prototype)
+	{
+		if (prototype == nullptr)
+		{
+			throw std::runtime_error("Cannot register a null prototype!");
+		}
+		if (prototype->GetParent() != nullptr)
+		{
+			throw std::runtime_error("A prototype cannot have a parent!");
+		}
+
+		auto iter = mPrototypes.Prototypes.Find(name);
+		if (iter != mPrototypes.Prototypes.end())
+		{
+			if (iter->second != prototype)
+			{
+				delete iter->second;
+				iter->second = prototype;
+			}
+			return;
+		}
+		mPrototypes.Prototypes.Insert(std::make_pair(name, prototype));
+	}
+
+	void PrototypeRegistry::Unregister(const std::string& name)
+	{
+		auto iter = mPrototypes.Prototypes.Find(name);
+		if (iter != mPrototypes.Prototypes.end())
+		{
+			delete iter->second;
+			mPrototypes.Prototypes.Remove(name);
+		}
+	}
+
+	const Scope* PrototypeRegistry::Find(std::string_view name)
+	{
+		auto iter = mPrototypes.Prototypes.Find(name);
+		return (iter != mPrototypes.Prototypes.end()) ? iter->second : nullptr;
+	}
+
+	bool PrototypeRegistry::Contains(std::string_view name)
+	{
+		return (mPrototypes.Prototypes.Find(name) != mPrototypes.Prototypes.end());
+	}
+
+	gsl::owner<Scope*> PrototypeRegistry::Instantiate(std::string_view name)
+	{
+		const Scope* prototype = Find(name);
+		if (prototype == nullptr)
+		{
+			throw std::runtime_error("No prototype is registered under the provided name!");
+		}
+		return prototype->CloneShared();
+	}
+
+	size_t PrototypeRegistry::Size()
+	{
+		return mPrototypes.Prototypes.Size();
+	}
+
+	void PrototypeRegistry::Clear()
+	{
+		for (auto& pair : mPrototypes.Prototypes)
+		{
+			delete pair.second;
+		}
+		mPrototypes.Prototypes.Clear();
+	}
+}
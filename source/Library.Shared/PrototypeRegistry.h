@@ -0,0 +1,82 @@
+#pragma once
+#include "Scope.h"
+#include "FlatHashMap.h"
+
+namespace Library
+{
+	/// <summary>
+	/// Singleton registry of named prototypes: fully configured Scope trees (Entities, Actions, Sectors, ...) that are
+	/// spawned by cloning instead of being built by a Factory and configured attribute by attribute. Clones share the
+	/// prototype's Datum buffers until written, and prescribed attributes are rebound positionally by the copy
+	/// constructors, so instantiation neither re-runs Populate nor looks up attribute names.
+	/// </summary>
+	class PrototypeRegistry
+	{
+	public:
+		PrototypeRegistry() = delete;
+		PrototypeRegistry(const PrototypeRegistry& rhs) = delete;
+		PrototypeRegistry(PrototypeRegistry&& rhs) = delete;
+		PrototypeRegistry& operator=(const PrototypeRegistry& rhs) = delete;
+		PrototypeRegistry& operator=(PrototypeRegistry&& rhs) = delete;
+
+		/// <summary>
+		/// Registers a prototype under passed name, taking ownership of it. A prototype already registered under the
+		/// name is deleted and replaced.
+		/// </summary>
+		/// <param name="name">Name of the prototype</param>
+		/// <param name="prototype">Heap allocated scope without a parent</param>
+		static void Register(const std::string& name, gsl::owner<Scope*> prototype);
+
+		/// <summary>
+		/// Removes and deletes the prototype registered under passed name, if any
+		/// </summary>
+		/// <param name="name">Name of the prototype</param>
+		static void Unregister(const std::string& name);
+
+		/// <summary>
+		/// Finds the prototype registered under passed name
+		/// </summary>
+		/// <param name="name">Name of the prototype</param>
+		/// <returns>Pointer to the prototype, nullptr if none is registered under the name</returns>
+		static const Scope* Find(std::string_view name);
+
+		/// <summary>
+		/// Determines whether a prototype is registered under passed name
+		/// </summary>
+		/// <param name="name">Name of the prototype</param>
+		/// <returns>True if registered, false if not</returns>
+		static bool Contains(std::string_view name);
+
+		/// <summary>
+		/// Spawns a new instance of the prototype registered under passed name
+		/// </summary>
+		/// <param name="name">Name of the prototype</param>
+		/// <returns>Pointer to the new instance, owned by the caller</returns>
+		static gsl::owner<Scope*> Instantiate(std::string_view name);
+
+		/// <summary>
+		/// Provides the number of registered prototypes
+		/// </summary>
+		/// <returns>Number of prototypes</returns>
+		static size_t Size();
+
+		/// <summary>
+		/// Deletes every registered prototype
+		/// </summary>
+		static void Clear();
+
+	private:
+		/// <summary>
+		/// Map of the registered prototypes, deleting those still registered when the program exits
+		/// </summary>
+		struct PrototypeTable final
+		{
+			PrototypeTable();
+			~PrototypeTable();
+
+			FlatHashMap<std::string, gsl::owner<Scope*>> Prototypes;
+		};
+
+		static PrototypeTable mPrototypes;
+	};
+}
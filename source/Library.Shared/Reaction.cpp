@@ -7,7 +7,7 @@ namespace Library
 
 	Vector<Signature> Reaction::Signatures()
 	{
-		return Vector<Signature>();
+		return ActionList::Signatures();
 	}
 
 	void Reaction::Update(WorldState&)
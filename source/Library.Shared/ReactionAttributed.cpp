@@ -9,11 +9,12 @@ namespace Library
 	RTTI_DEFINITIONS(ReactionAttributed)
 
 	const std::string ReactionAttributed::SubtypeKey = "Subtype";
-	const std::size_t ReactionAttributed::SubtypeIndex = 3;
 
 	Vector<Signature> ReactionAttributed::Signatures()
 	{
-		return {{ SubtypeKey, Datum::DatumType::STRING, 1, offsetof(ReactionAttributed, mSubtype) }};
+		Vector<Signature> signatures = Reaction::Signatures();
+		signatures.PushBack(PRESCRIBED_ATTRIBUTE(ReactionAttributed, SubtypeKey, mSubtype));
+		return signatures;
 	}
 
 	ReactionAttributed::ReactionAttributed(const std::string& subtype, const std::string& name) : Reaction(TypeIdClass(), name), mSubtype(subtype)
@@ -62,14 +63,10 @@ namespace Library
 		const Event<EventMessageAttributed>* actualEvent = static_cast<const Event<EventMessageAttributed>*>(&event);
 		const EventMessageAttributed& payload = actualEvent->Message();
 		
-		auto attributes = payload.GetAttributes();
-		for (auto& attribute : attributes)
+		for (const LookupTableEntry* attribute : payload.GetAuxiliaryAttributes())
 		{
-			if (!payload.IsPrescribedAttribute(attribute->first))
-			{
-				auto& datum = Append(attribute->first);
-				datum = attribute->second;
-			}
+			auto& datum = Append(attribute->first);
+			datum = attribute->second;
 		}
 		if (payload.Subtype() == mSubtype)
 		{
@@ -14,7 +14,8 @@ namespace Library
 	public:
 
 		static const std::string SubtypeKey;
-		static const std::size_t SubtypeIndex;
+		static constexpr size_t SubtypeIndex = Reaction::PrescribedSlotCount;
+		static constexpr size_t PrescribedSlotCount = SubtypeIndex + 1;
 
 		/// <summary>
 		/// Gets signatures to be passed to TypeRegistry
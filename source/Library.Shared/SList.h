@@ -1,4 +1,5 @@
 #pragma once
+#include "MemoryResource.h"
 
 namespace Library
 {
@@ -25,7 +26,13 @@ namespace Library
 		SList() = default;			
 
 		/// <summary>
-		/// Copy constructor for singly-linked list
+		/// Constructor that allocates nodes from the provided resource instead of the default one
+		/// </summary>
+		/// <param name="resource">Resource the nodes are allocated from</param>
+		explicit SList(MemoryResource& resource);
+
+		/// <summary>
+		/// Copy constructor for singly-linked list, the copy allocates from the default resource
 		/// </summary>
 		/// <param name="rhs">List to be copied</param>
 		SList(const SList& rhs);	
@@ -375,12 +382,29 @@ namespace Library
 		/// <param name="data">Data to be added</param>
 		Iterator PushBack(const T& data);
 
-		
+		/// <summary>
+		/// Relinks the front node onto the back of another list without copying its data. If the lists allocate from
+		/// different resources the data is copied into a new node instead.
+		/// </summary>
+		/// <param name="destination">List that receives the node</param>
+		/// <returns>Iterator pointing to the moved data in the destination list</returns>
+		/// <exception cref="List is empty">Invoking list has no front node to move</exception>
+		Iterator MoveFrontTo(SList& destination);
+
+		/// <summary>
+		/// Provides the resource the nodes are allocated from
+		/// </summary>
+		/// <returns>Reference to the memory resource</returns>
+		MemoryResource& Resource() const;
 	
 	private:
+		Node* CreateNode(const T& data, Node* next);
+		void DestroyNode(Node* node);
+
 		size_t mSize{ 0 };			//initializes to 0
 		Node* mFront{ nullptr };
 		Node* mBack{ nullptr };
+		MemoryResource* mResource{ &MemoryResource::Default() };
 	};
 }
 
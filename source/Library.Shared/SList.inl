@@ -10,6 +10,11 @@ namespace Library
 	}
 #pragma endregion Node
 
+	template<typename T>
+	inline SList<T>::SList(MemoryResource& resource) : mResource(&resource)
+	{
+	}
+
 	template<typename T>
 	SList<T>::SList(const SList& rhs)
 	{
@@ -29,7 +34,7 @@ namespace Library
 	}
 
 	template<typename T>
-	SList<T>::SList(SList&& rhs) : mSize(rhs.mSize), mFront(rhs.mFront), mBack(rhs.mBack)
+	SList<T>::SList(SList&& rhs) : mSize(rhs.mSize), mFront(rhs.mFront), mBack(rhs.mBack), mResource(rhs.mResource)
 	{
 		rhs.mSize = 0;
 		rhs.mFront = nullptr;
@@ -62,11 +67,13 @@ namespace Library
 			mSize = rhs.mSize;
 			mFront = rhs.mFront;
 			mBack = rhs.mBack;
+			mResource = rhs.mResource;
 
 			rhs.mSize = 0;
 			rhs.mFront = nullptr;
 			rhs.mBack = nullptr;
 		}
+		return *this;
 	}
 
 	template <typename T>
@@ -84,7 +91,7 @@ namespace Library
 	template<typename T>
 	void SList<T>::PushFront(const T& data)
 	{
-		mFront = new Node(data, mFront);
+		mFront = CreateNode(data, mFront);
 		if (IsEmpty()) 
 		{
 			mBack = mFront;
@@ -118,7 +125,7 @@ namespace Library
 		if (!IsEmpty())
 		{
 			Node* node = mFront->Next;
-			delete mFront;
+			DestroyNode(mFront);
 			mFront = node;
 
 			mSize--;
@@ -132,7 +139,7 @@ namespace Library
 	template<typename T>
 	typename SList<T>::Iterator SList<T>::PushBack(const T& data)
 	{
-		Node* node = new Node(data, nullptr);
+		Node* node = CreateNode(data, nullptr);
 		if (IsEmpty())
 		{
 			mFront = node;
@@ -146,6 +153,71 @@ namespace Library
 		return Iterator(mBack, *this);
 	}
 
+	template<typename T>
+	typename SList<T>::Iterator SList<T>::MoveFrontTo(SList& destination)
+	{
+		if (IsEmpty())
+		{
+			throw std::runtime_error("List is empty.");
+		}
+
+		if (mResource != destination.mResource)
+		{
+			Iterator iter = destination.PushBack(mFront->Data);
+			PopFront();
+			return iter;
+		}
+
+		Node* node = mFront;
+		mFront = node->Next;
+		mSize--;
+		if (mSize <= 1)
+		{
+			mBack = mFront;
+		}
+
+		node->Next = nullptr;
+		if (destination.IsEmpty())
+		{
+			destination.mFront = node;
+		}
+		else
+		{
+			destination.mBack->Next = node;
+		}
+		destination.mBack = node;
+		destination.mSize++;
+		return Iterator(node, destination);
+	}
+
+	template<typename T>
+	inline MemoryResource& SList<T>::Resource() const
+	{
+		return *mResource;
+	}
+
+	template<typename T>
+	inline typename SList<T>::Node* SList<T>::CreateNode(const T& data, Node* next)
+	{
+		void* memory = mResource->Allocate(sizeof(Node));
+		try
+		{
+			return new (memory)Node(data, next);
+		}
+		catch (...)
+		{
+			mResource->Deallocate(memory, sizeof(Node));
+			throw;
+		}
+	}
+
+	template<typename T>
+	inline void SList<T>::DestroyNode(Node* node)
+	{
+		node->~Node();
+		mResource->Deallocate(node, sizeof(Node));
+	}
+
 	template<typename T>
 	inline T& SList<T>::Back()
 	{
@@ -191,7 +263,7 @@ namespace Library
 				penultimate = end;
 				end = end->Next;
 			}
-			delete end;
+			DestroyNode(end);
 			penultimate->Next = nullptr;
 			mSize--;
 			mBack = penultimate;
@@ -254,7 +326,7 @@ namespace Library
 			}
 			else
 			{
-				Node* insert = new Node(data, iter.mCurrent->Next);
+				Node* insert = CreateNode(data, iter.mCurrent->Next);
 				if (mBack == iter.mCurrent)
 				{
 					mBack = insert;
@@ -321,7 +393,7 @@ namespace Library
 				it.mCurrent->Data.~T();
 				new(&it.mCurrent->Data)T(std::move(next->Data));
 				it.mCurrent->Next = next->Next;
-				delete next;
+				DestroyNode(next);
 
 				if (it.mCurrent->Next == nullptr)
 				{
@@ -53,6 +53,25 @@ namespace Library
 		Clear();
 	}
 
+	void* Scope::operator new(size_t bytes)
+	{
+		return ObjectPool::Allocate(bytes);
+	}
+
+	void* Scope::operator new(size_t, void* place) noexcept
+	{
+		return place;
+	}
+
+	void Scope::operator delete(void* pointer, size_t bytes)
+	{
+		ObjectPool::Deallocate(pointer, bytes);
+	}
+
+	void Scope::operator delete(void*, void*) noexcept
+	{
+	}
+
 	void Scope::Clear()
 	{
 		Orphan();
@@ -71,28 +90,42 @@ namespace Library
 		}
 		mPointersVector.Clear();
 		mLookupTable.Clear();
+		InvalidateStructuralHash();
 	}
 
 	bool Scope::operator==(const Scope& rhs) const
 	{
-		if (mPointersVector.Size() == rhs.mPointersVector.Size())
+		if (this == &rhs)
 		{
-			auto left = mPointersVector.begin();
-			auto right = rhs.mPointersVector.begin();
+			return true;
+		}
 
-			for (; left != mPointersVector.end(); ++left, ++right)
-			{
-				const auto& left_pair = **left;
-				const auto& right_pair = **right;
+		if (mPointersVector.Size() != rhs.mPointersVector.Size())
+		{
+			return false;
+		}
 
-				if (left_pair != right_pair)
-				{
-					return false;
-				}
+		//Different cached hashes prove the scopes differ. A volatile hash would be recomputed for every nested scope the
+		//walk below reaches, so volatile scopes, e.g. any Attributed, go straight to the walk.
+		if (HasStableStructuralHash() && rhs.HasStableStructuralHash() && mStructuralHash != rhs.mStructuralHash)
+		{
+			return false;
+		}
+
+		auto left = mPointersVector.begin();
+		auto right = rhs.mPointersVector.begin();
+
+		for (; left != mPointersVector.end(); ++left, ++right)
+		{
+			const auto& left_pair = **left;
+			const auto& right_pair = **right;
+
+			if (left_pair != right_pair)
+			{
+				return false;
 			}
-			return true;
 		}
-		return false;
+		return true;
 	}
 
 	bool Scope::operator!=(const Scope& rhs) const
@@ -100,17 +133,17 @@ namespace Library
 		return !(operator==(rhs));
 	}
 
-	Datum& Scope::operator[](const std::string& name)
+	Datum& Scope::operator[](std::string_view name)
 	{
 		return Append(name);
 	}
 
-	const Datum& Scope::operator[](const std::string& name) const
+	const Datum& Scope::operator[](std::string_view name) const
 	{
 		return At(name);
 	}
 
-	Datum& Scope::At(const std::string& name)
+	Datum& Scope::At(std::string_view name)
 	{
 		Datum* datum = Find(name);
 		if (datum == nullptr)
@@ -120,7 +153,37 @@ namespace Library
 		return *datum;
 	}
 
-	const Datum& Scope::At(const std::string& name) const
+	const Datum& Scope::At(std::string_view name) const
+	{
+		const Datum* datum = Find(name);
+		if (datum == nullptr)
+		{
+			throw std::runtime_error("Invalid operation! Entry not found!");
+		}
+		return *datum;
+	}
+
+	Datum& Scope::operator[](const InternedString& name)
+	{
+		return Append(name);
+	}
+
+	const Datum& Scope::operator[](const InternedString& name) const
+	{
+		return At(name);
+	}
+
+	Datum& Scope::At(const InternedString& name)
+	{
+		Datum* datum = Find(name);
+		if (datum == nullptr)
+		{
+			throw std::runtime_error("Invalid operation! Entry not found!");
+		}
+		return *datum;
+	}
+
+	const Datum& Scope::At(const InternedString& name) const
 	{
 		const Datum* datum = Find(name);
 		if (datum == nullptr)
@@ -148,7 +211,7 @@ namespace Library
 		return mPointersVector[index]->second;
 	}
 
-	Datum* Scope::Find(const std::string& name)
+	Datum* Scope::Find(std::string_view name)
 	{
 		if (name.empty())
 		{
@@ -163,7 +226,7 @@ namespace Library
 		return &(iter->second);
 	}
 
-	const Datum* Scope::Find(const std::string& name) const
+	const Datum* Scope::Find(std::string_view name) const
 	{
 		if (name.empty())
 		{
@@ -178,7 +241,51 @@ namespace Library
 		return &(iter->second);
 	}
 
-	Datum* Scope::Search(const std::string& name, Scope** owner)
+	Datum* Scope::Find(const InternedString& name)
+	{
+		auto iter = mLookupTable.Find(name);
+		if (iter == mLookupTable.end())
+		{
+			return nullptr;
+		}
+		return &(iter->second);
+	}
+
+	const Datum* Scope::Find(const InternedString& name) const
+	{
+		auto iter = mLookupTable.Find(name);
+		if (iter == mLookupTable.end())
+		{
+			return nullptr;
+		}
+		return &(iter->second);
+	}
+
+	Datum* Scope::Search(std::string_view name, Scope** owner)
+	{
+		Datum* datum = Find(name);
+
+		if (datum != nullptr)
+		{
+			if (owner != nullptr)
+			{
+				*owner = this;
+			}
+			return datum;
+		}
+
+		if (mParent == nullptr)
+		{
+			if (owner != nullptr)
+			{
+				*owner = nullptr;
+			}
+			return nullptr;
+		}
+		return mParent->Search(name, owner);
+	}
+
+	Datum* Scope::Search(const InternedString& name, Scope** owner)
 	{
 		Datum* datum = Find(name);
 
@@ -202,26 +309,48 @@ namespace Library
 		return mParent->Search(name, owner);
 	}
 
-	Datum& Scope::Append(const std::string& name)
+	Datum& Scope::Append(std::string_view name)
 	{
 		if (name.empty())
 		{
 			throw std::runtime_error("Invalid operation! Provided name is empty!");
 		}
 
-		bool inserted = false;
-		Datum datum;
+		auto iter = mLookupTable.Find(name);
+		if (iter != mLookupTable.end())
+		{
+			return iter->second;
+		}
 
-		auto iter = mLookupTable.Insert(std::make_pair(name, datum), inserted);
+		iter = mLookupTable.Insert(std::make_pair(std::string(name), Datum()));
+		mPointersVector.PushBack(&*iter);
+		iter->second.mOwner = this;
+		InvalidateStructuralHash();
+		return iter->second;
+	}
 
-		if (inserted)
+	Datum& Scope::Append(const InternedString& name)
+	{
+		if (name.String().empty())
 		{
-			mPointersVector.PushBack(&*iter);
+			throw std::runtime_error("Invalid operation! Provided name is empty!");
 		}
+
+		auto iter = mLookupTable.Find(name);
+		if (iter != mLookupTable.end())
+		{
+			return iter->second;
+		}
+
+		bool inserted;
+		iter = mLookupTable.Insert(std::make_pair(name.String(), Datum()), name.Hash(), inserted);
+		mPointersVector.PushBack(&*iter);
+		iter->second.mOwner = this;
+		InvalidateStructuralHash();
 		return iter->second;
 	}
 
-	Scope& Scope::AppendScope(const std::string& name)
+	Scope& Scope::AppendScope(std::string_view name)
 	{
 		Datum& datum = Append(name);
 
@@ -235,12 +364,11 @@ namespace Library
 		}
 
 		Scope* scope = new Scope();
-		scope->mParent = this;
-		datum.PushBack(*scope);
+		AttachChild(datum, *scope);
 		return *scope;
 	}
 
-	void Scope::Adopt(Scope& child, const std::string& name)
+	void Scope::Adopt(Scope& child, std::string_view name)
 	{
 		if (this == &child)
 		{
@@ -253,25 +381,82 @@ namespace Library
 		Datum& datum = Append(name);
 		datum.SetType(Datum::DatumType::TABLE);
 		child.Orphan();
-		child.mParent = this;
-		datum.PushBack(child);
+		AttachChild(datum, child);
+	}
+
+	void Scope::AdoptRange(Span<Scope* const> children, std::string_view name)
+	{
+		//A child may not be this scope or one of its ancestors, so check every child against the ancestor chain walked once
+		Vector<const Scope*> lineage;
+		for (const Scope* scope = this; scope != nullptr; scope = scope->mParent)
+		{
+			lineage.PushBack(scope);
+		}
+		Span<const Scope*> ancestors = lineage.AsSpan();
+		std::sort(ancestors.begin(), ancestors.end());
+		for (const Scope* child : children)
+		{
+			if (std::binary_search(ancestors.begin(), ancestors.end(), child))
+			{
+				throw std::runtime_error(child == this ? "Invalid operation! Scope cannot adopt itself!" : "Invalid operation! Scope cannot adopt an ancestor!");
+			}
+		}
+		Datum& destination = Append(name);
+		destination.SetType(Datum::DatumType::TABLE);
+
+		//Each orphan leaves a tombstone, every table that lost children is compacted once, in order, when next read
+		for (Scope* child : children)
+		{
+			child->Orphan();
+		}
+
+		destination.Reserve(destination.Size() + children.Size());
+		for (Scope* child : children)
+		{
+			//A duplicate was already attached by its first occurrence
+			if (child->mParent == nullptr)
+			{
+				AttachChild(destination, *child);
+			}
+		}
+	}
+
+	void Scope::MoveChildren(Scope& source, std::string_view sourceName, std::string_view name)
+	{
+		Datum* datum = source.Find(sourceName);
+		if (datum == nullptr || datum->Type() != Datum::DatumType::TABLE)
+		{
+			throw std::runtime_error("Provided name does not correspond to a table of the source scope");
+		}
+
+		Vector<Scope*> children(datum->Size());
+		for (size_t i = 0; i < datum->Size(); ++i)
+		{
+			children.PushBack(&(*datum)[i]);
+		}
+		AdoptRange(children.AsSpan(), name);
 	}
 
 	std::pair<Datum*, size_t> Scope::FindContainedScope(const Scope& child) const
 	{
+		if (child.mParent == this && child.HasValidParentSlot())
+		{
+			//Removing the tombstones makes the recorded slot the child's index
+			child.mParentDatum->CompactTable();
+			return std::make_pair(child.mParentDatum, child.mParentIndex);
+		}
+
+		//The recorded slot goes stale only if the table datum was edited directly, fall back to a scan
 		for (size_t i = 0; i < mPointersVector.Size(); ++i)
 		{
 			Datum& datum = mPointersVector[i]->second;
 
 			if (datum.Type() == Datum::DatumType::TABLE)
 			{
-				for (size_t j = 0; j < datum.Size(); ++j)
+				size_t index = datum.Find(child);
+				if (index < datum.Size())
 				{
-					Scope* potential_child = &datum[j];
-					if (potential_child == &child)
-					{
-						return std::make_pair(&datum, j);
-					}
+					return std::make_pair(&datum, index);
 				}
 			}
 		}
@@ -282,20 +467,36 @@ namespace Library
 	{
 		if (mParent != nullptr)
 		{
-			for (auto& iter : mParent->mPointersVector)
+			if (!HasValidParentSlot())
 			{
-				if (iter->second.Type() == Datum::DatumType::TABLE)
-				{
-					if (iter->second.Remove(*this))
-					{
-						mParent = nullptr;
-						break;
-					}
-				}
+				std::tie(mParentDatum, mParentIndex) = mParent->FindContainedScope(*this);
+			}
+			if (mParentDatum != nullptr)
+			{
+				//A tombstone keeps the later siblings in place, and in order, since actions and entities run in table order
+				mParentDatum->Tombstone(mParentIndex);
+				mParent = nullptr;
+				mParentDatum = nullptr;
+				mParentIndex = 0;
 			}
 		}
 	}
 
+	void Scope::AttachChild(Datum& datum, Scope& child)
+	{
+		child.mParent = this;
+		child.mParentDatum = &datum;
+		//The raw size, appending never needs the tombstones removed
+		child.mParentIndex = datum.mSize;
+		datum.PushBack(child);
+	}
+
+	bool Scope::HasValidParentSlot() const
+	{
+		//Reads the raw slots, so checking the slot does not remove tombstones
+		return (mParentDatum != nullptr && mParentDatum->Type() == Datum::DatumType::TABLE && mParentIndex < mParentDatum->mSize && mParentDatum->mData.mScope[mParentIndex] == this);
+	}
+
 
 
 
@@ -365,8 +566,7 @@ namespace Library
 				for (size_t i = 0; i < existingDatum.Size(); ++i)
 				{
 					Scope* sc = existingDatum[i].Clone();
-					sc->mParent = this;
-					newDatum.PushBack(*sc);
+					AttachChild(newDatum, *sc);
 				}
 			}
 		}
@@ -377,14 +577,32 @@ namespace Library
 		//Update parent
 		if (mParent != nullptr)
 		{
-			std::pair<Datum*, size_t> container = mParent->FindContainedScope(rhs);
-			container.first->Set(this, container.second);
+			if (rhs.HasValidParentSlot())
+			{
+				//Take over the slot in place, without compacting the parent's table
+				mParentDatum = rhs.mParentDatum;
+				mParentIndex = rhs.mParentIndex;
+				mParentDatum->MarkModified();
+				mParentDatum->mData.mScope[mParentIndex] = this;
+			}
+			else
+			{
+				std::pair<Datum*, size_t> container = mParent->FindContainedScope(rhs);
+				container.first->Set(*this, container.second);
+				mParentDatum = container.first;
+				mParentIndex = container.second;
+			}
 		}
+		rhs.mParentDatum = nullptr;
+		rhs.mParentIndex = 0;
+		rhs.mIsStructuralHashValid = false;
+		mIsStructuralHashValid = false;
 
 		//Update children
 		for (auto& iter : mPointersVector)
 		{
 			Datum& datum = iter->second;
+			datum.mOwner = this;
 			if (datum.Type() == Datum::DatumType::TABLE)
 			{
 				for (size_t i = 0; i < datum.Size(); ++i)
@@ -405,8 +623,156 @@ namespace Library
 		return new Scope(*this);
 	}
 
-	const Vector<std::pair<std::string, Datum>*> Scope::GetPointersList() const
+	gsl::owner<Scope*> Scope::CloneShared() const
+	{
+		CopyOnWriteGuard guard;
+		return Clone();
+	}
+
+	MemoryFootprint Scope::Footprint() const
+	{
+		MemoryFootprint footprint = mLookupTable.Footprint();
+		footprint += mPointersVector.Footprint();
+		++footprint.Scopes;
+
+		for (const LookupTableEntry* entry : mPointersVector)
+		{
+			footprint.Strings += MemoryFootprint::HeapBytes(entry->first);
+			const Datum& datum = entry->second;
+			footprint += datum.Footprint();
+			if (datum.Type() == Datum::DatumType::TABLE)
+			{
+				for (size_t i = 0; i < datum.Size(); ++i)
+				{
+					footprint += datum[i].Footprint();
+				}
+			}
+		}
+		return footprint;
+	}
+
+	void Scope::Compact()
+	{
+		mLookupTable.ShrinkToFit();
+		mPointersVector.ShrinkToFit();
+
+		for (LookupTableEntry* entry : mPointersVector)
+		{
+			Datum& datum = entry->second;
+			datum.ShrinkToFit();
+			if (datum.Type() == Datum::DatumType::TABLE)
+			{
+				for (size_t i = 0; i < datum.Size(); ++i)
+				{
+					datum[i].Compact();
+				}
+			}
+		}
+	}
+
+	size_t Scope::StructuralHash() const
+	{
+		//Entry hashes are summed, each seeded with its position, so the stable entries can be cached apart from the volatile ones
+		if (!mIsStructuralHashValid)
+		{
+			//One pass hashes every entry; the volatile ones are summed apart so nested scopes are not hashed twice
+			size_t hash = static_cast<size_t>(IntegerHash(mPointersVector.Size()));
+			size_t volatileHash = 0;
+			mHasVolatileEntries = false;
+			for (size_t i = 0; i < mPointersVector.Size(); ++i)
+			{
+				bool isVolatile;
+				size_t entryHash = HashEntry(i, *mPointersVector[i], isVolatile);
+				if (isVolatile)
+				{
+					mHasVolatileEntries = true;
+					volatileHash += entryHash;
+				}
+				else
+				{
+					hash += entryHash;
+				}
+			}
+			mStructuralHash = hash;
+			mIsStructuralHashValid = true;
+			return hash + volatileHash;
+		}
+
+		if (!mHasVolatileEntries)
+		{
+			return mStructuralHash;
+		}
+
+		size_t hash = mStructuralHash;
+		for (size_t i = 0; i < mPointersVector.Size(); ++i)
+		{
+			if (IsVolatileEntry(*mPointersVector[i]))
+			{
+				bool isVolatile;
+				hash += HashEntry(i, *mPointersVector[i], isVolatile);
+			}
+		}
+		return hash;
+	}
+
+	bool Scope::HasStableStructuralHash() const
+	{
+		if (!mIsStructuralHashValid)
+		{
+			StructuralHash();
+		}
+		return !mHasVolatileEntries;
+	}
+
+	size_t Scope::HashEntry(size_t position, const LookupTableEntry& entry, bool& isVolatile)
+	{
+		const Datum& datum = entry.second;
+		std::uint64_t hash = ByteHash(entry.first.data(), entry.first.size(), IntegerHash(position));
+		hash = IntegerHash(hash ^ datum.Hash());
+		isVolatile = (datum.IsExternal() || datum.mHasMutableViews);
+		if (datum.Type() == Datum::DatumType::TABLE)
+		{
+			for (size_t i = 0; i < datum.Size(); ++i)
+			{
+				const Scope& child = datum[i];
+				hash = IntegerHash(hash ^ child.StructuralHash());
+				isVolatile = isVolatile || child.mHasVolatileEntries;
+			}
+		}
+		return static_cast<size_t>(hash);
+	}
+
+	bool Scope::IsVolatileEntry(const LookupTableEntry& entry)
+	{
+		const Datum& datum = entry.second;
+		if (datum.IsExternal() || datum.mHasMutableViews)
+		{
+			return true;
+		}
+		if (datum.Type() == Datum::DatumType::TABLE)
+		{
+			for (size_t i = 0; i < datum.Size(); ++i)
+			{
+				if (datum[i].mHasVolatileEntries)
+				{
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	void Scope::InvalidateStructuralHash()
+	{
+		//A stale scope only ever has stale ancestors, so the walk stops at the first one already marked
+		for (Scope* scope = this; scope != nullptr && scope->mIsStructuralHashValid; scope = scope->mParent)
+		{
+			scope->mIsStructuralHashValid = false;
+		}
+	}
+
+	Scope::AttributeSpan Scope::GetPointersList() const
 	{
-		return mPointersVector;
+		return mPointersVector.AsSpan();
 	}
 }
\ No newline at end of file
@@ -1,9 +1,12 @@
 #pragma once
 #include "RTTI.h"
 #include "Datum.h"
-#include "HashMap.h"
+#include "FlatHashMap.h"
+#include "InternedString.h"
+#include "ObjectPool.h"
 #include "Vector.h"
 #include <gsl/gsl>
+#include <string_view>
 
 namespace Library
 {
@@ -15,14 +18,20 @@ namespace Library
 		RTTI_DECLARATIONS(Scope, RTTI)
 	
 	public:
-		using LookupTable = HashMap<std::string, Datum>;
+		/// <summary>
+		/// Map of the attributes. Scope is not a template, since every Attributed type and factory derives from or creates
+		/// it, so the container is chosen by this alias. It needs FlatHashMap's interface, including the Insert and Find
+		/// overloads that take a precomputed hash, and entries whose addresses survive growth.
+		/// </summary>
+		using LookupTable = FlatHashMap<std::string, Datum>;
 		using LookupTableEntry = LookupTable::PairType;
 		using PointersVector = Vector<LookupTableEntry*>;
+		using AttributeSpan = Span<LookupTableEntry* const>;
 
 		/// <summary>
 		/// Parameterized constructor
 		/// </summary>
-		/// <param name="size">Size for HashMap</param>
+		/// <param name="size">Size for the lookup table</param>
 		explicit Scope(size_t size = 11);
 
 		/// <summary>
@@ -56,6 +65,33 @@ namespace Library
 		/// </summary>
 		virtual ~Scope();
 
+		/// <summary>
+		/// Allocates Scope and every derived type (AppendScope, factories, Clone) from ObjectPool
+		/// </summary>
+		/// <param name="bytes">Size of the most derived type</param>
+		/// <returns>Pointer to the storage</returns>
+		static void* operator new(size_t bytes);
+
+		/// <summary>
+		/// Placement new, constructs in storage provided by the caller
+		/// </summary>
+		/// <param name="bytes">Size of the object</param>
+		/// <param name="place">Storage for the object</param>
+		/// <returns>The storage</returns>
+		static void* operator new(size_t bytes, void* place) noexcept;
+
+		/// <summary>
+		/// Returns the storage of a deleted Scope to ObjectPool; the virtual destructor supplies the size of the most derived type
+		/// </summary>
+		/// <param name="pointer">Pointer to the storage</param>
+		/// <param name="bytes">Size of the most derived type</param>
+		static void operator delete(void* pointer, size_t bytes);
+
+		/// <summary>
+		/// Matches placement new, does nothing
+		/// </summary>
+		static void operator delete(void* pointer, void* place) noexcept;
+
 		/// <summary>
 		/// Recursively deletes the contents within a scope
 		/// </summary>
@@ -64,16 +100,30 @@ namespace Library
 		/// <summary>
 		/// Wrapper for Append
 		/// </summary>
-		/// <param name="name">Const reference to name of the datum that's to be added</param>
+		/// <param name="name">Name of the datum that's to be added</param>
+		/// <returns>Reference of the datum in the Scope</returns>
+		Datum& operator[](std::string_view name);
+
+		/// <summary>
+		/// Const version of operator[std::string_view] -- Wraps At
+		/// </summary>
+		/// <param name="name">Name of the datum that's to be added</param>
+		/// <returns>Const reference of the datum in the Scope</returns>
+		const Datum& operator[](std::string_view name) const;
+
+		/// <summary>
+		/// Wrapper for Append, uses the precomputed hash of the interned name
+		/// </summary>
+		/// <param name="name">Interned name of the datum that's to be added</param>
 		/// <returns>Reference of the datum in the Scope</returns>
-		Datum& operator[](const std::string& name);
+		Datum& operator[](const InternedString& name);
 
 		/// <summary>
-		/// Const version of operator[std::string] -- Wraps At
+		/// Const version of operator[InternedString] -- Wraps At
 		/// </summary>
-		/// <param name="name">Const reference to name of the datum that's to be added</param>
+		/// <param name="name">Interned name of the datum</param>
 		/// <returns>Const reference of the datum in the Scope</returns>
-		const Datum& operator[](const std::string& name) const;
+		const Datum& operator[](const InternedString& name) const;
 
 		/// <summary>
 		/// Provides reference to datum at provided index
@@ -92,16 +142,30 @@ namespace Library
 		/// <summary>
 		/// Wrapper for Find()
 		/// </summary>
-		/// <param name="name">Const reference to std::string -- name which is to be searched</param>
+		/// <param name="name">Name which is to be searched</param>
 		/// <returns>Reference to the datum if found</returns>
-		Datum& At(const std::string& name);
+		Datum& At(std::string_view name);
 
 		/// <summary>
 		/// Const version of At()
 		/// </summary>
-		/// <param name="name">Const reference to std::string -- name which is to be searched</param>
+		/// <param name="name">Name which is to be searched</param>
+		/// <returns>Reference to the datum if found</returns>
+		const Datum& At(std::string_view name) const;
+
+		/// <summary>
+		/// Wrapper for Find(InternedString)
+		/// </summary>
+		/// <param name="name">Interned name which is to be searched</param>
 		/// <returns>Reference to the datum if found</returns>
-		const Datum& At(const std::string& name) const;
+		Datum& At(const InternedString& name);
+
+		/// <summary>
+		/// Const version of At(InternedString)
+		/// </summary>
+		/// <param name="name">Interned name which is to be searched</param>
+		/// <returns>Reference to the datum if found</returns>
+		const Datum& At(const InternedString& name) const;
 
 		/// <summary>
 		/// Comparison operator for Scope -- does check of nested scopes and children
@@ -122,43 +186,90 @@ namespace Library
 		/// </summary>
 		/// <param name="name">Given name</param>
 		/// <returns>Pointer to datum if found, returns nullptr if not</returns>
-		Datum* Find(const std::string& name);
+		Datum* Find(std::string_view name);
 
 		/// <summary>
 		/// Const version of find
 		/// </summary>
 		/// <param name="name">Given name</param>
 		/// <returns>Const pointer to datum if found, returns nullptr if not</returns>
-		const Datum* Find(const std::string& name) const;
+		const Datum* Find(std::string_view name) const;
+
+		/// <summary>
+		/// Finds a datum by interned name without rehashing it
+		/// </summary>
+		/// <param name="name">Interned name</param>
+		/// <returns>Pointer to datum if found, returns nullptr if not</returns>
+		Datum* Find(const InternedString& name);
+
+		/// <summary>
+		/// Const version of Find(InternedString)
+		/// </summary>
+		/// <param name="name">Interned name</param>
+		/// <returns>Const pointer to datum if found, returns nullptr if not</returns>
+		const Datum* Find(const InternedString& name) const;
 
 		/// <summary>
 		/// Returns address of the most-closely nested Datum associated with given name or its ancestors
 		/// </summary>
-		/// <param name="name">Const reference to name that will be searched</param>
+		/// <param name="name">Name that will be searched</param>
 		/// <param name="owner">Address of scope object which contains element if it's found</param>
 		/// <returns>Address of most-closely nested Datum nullptr if not found</returns>
-		Datum* Search(const std::string& name, Scope** owner = nullptr);
+		Datum* Search(std::string_view name, Scope** owner = nullptr);
 
 		/// <summary>
-		/// Adds datum to Scope if it doesn't already exist
+		/// Search by interned name -- the hash is reused at every level of the hierarchy
+		/// </summary>
+		/// <param name="name">Interned name that will be searched</param>
+		/// <param name="owner">Address of scope object which contains element if it's found</param>
+		/// <returns>Address of most-closely nested Datum nullptr if not found</returns>
+		Datum* Search(const InternedString& name, Scope** owner = nullptr);
+
+		/// <summary>
+		/// Adds datum to Scope if it doesn't already exist. The name is only copied into a std::string when a new entry is created.
 		/// </summary>
 		/// <param name="name">Name of the datum which is to be added</param>
 		/// <returns>Reference to datum in the scope</returns>
-		Datum& Append(const std::string& name);
+		Datum& Append(std::string_view name);
+
+		/// <summary>
+		/// Adds datum to Scope if it doesn't already exist, looking the name up with its precomputed hash
+		/// </summary>
+		/// <param name="name">Interned name of the datum which is to be added</param>
+		/// <returns>Reference to datum in the scope</returns>
+		Datum& Append(const InternedString& name);
 
 		/// <summary>
 		/// Adds scope to a scope if it doesn't already exist
 		/// </summary>
 		/// <param name="name">Name of datum which scope will be added to</param>
 		/// <returns>Reference to scope</returns>
-		Scope& AppendScope(const std::string& name);
+		Scope& AppendScope(std::string_view name);
 
 		/// <summary>
-		/// Adopts the passed scope, stored in Datum with passed name
+		/// Adopts the passed scope, stored in Datum with passed name, in constant time. The child's slot in its previous
+		/// parent becomes a tombstone, so the later siblings keep their order and are not touched until that table is read.
 		/// </summary>
 		/// <param name="child">Reference to child scope</param>
-		/// <param name="name">Const reference to name that of Datum that will store the child</param>
-		void Adopt(Scope& child, const std::string& name);
+		/// <param name="name">Name of Datum that will store the child</param>
+		void Adopt(Scope& child, std::string_view name);
+
+		/// <summary>
+		/// Adopts every passed scope into the Datum with passed name, keeping their order. Ancestry is validated once for
+		/// the whole batch before anything moves, each source table keeps the order of the siblings left behind and is
+		/// compacted in a single pass when next read, and the destination grows at most once.
+		/// </summary>
+		/// <param name="children">Scopes to adopt, duplicates and scopes without a parent are allowed</param>
+		/// <param name="name">Name of Datum that will store the children</param>
+		void AdoptRange(Span<Scope* const> children, std::string_view name);
+
+		/// <summary>
+		/// Moves every child stored in a table of another scope into the Datum with passed name, leaving the source table empty
+		/// </summary>
+		/// <param name="source">Scope the children are taken from</param>
+		/// <param name="sourceName">Name of the source table</param>
+		/// <param name="name">Name of Datum that will store the children</param>
+		void MoveChildren(Scope& source, std::string_view sourceName, std::string_view name);
 
 		/// <summary>
 		/// Gets parent of scope
@@ -167,7 +278,8 @@ namespace Library
 		Scope* GetParent() const;
 
 		/// <summary>
-		/// Finds contained scope
+		/// Finds contained scope, through the slot each child records for direct children. Tombstones in the child's table
+		/// are removed first, so the index is the child's index in the table.
 		/// </summary>
 		/// <param name="t_child">Constant address of scope to be found</param>
 		/// <returns>std::pair of Datum pointer and index at which Scope was found</returns>
@@ -208,16 +320,76 @@ namespace Library
 
 		virtual gsl::owner<Scope*> Clone() const;
 
+		/// <summary>
+		/// Clones the scope like Clone, but the Datums of the clone share their buffers with this scope's until either
+		/// side writes to them, so instantiating from a prototype costs the tree structure rather than the payload. Datums
+		/// that have handed out a mutable reference or span are copied. Several threads may clone the same scope at once.
+		/// </summary>
+		/// <returns>Pointer to the clone</returns>
+		gsl::owner<Scope*> CloneShared() const;
+
+		/// <summary>
+		/// Reports the heap bytes of this scope and every scope below it by category: lookup table slots and entries,
+		/// the insertion order vector, Datum buffers and string payloads. The Scope objects themselves are counted, not sized.
+		/// </summary>
+		/// <returns>Used and slack bytes of the whole tree</returns>
+		MemoryFootprint Footprint() const;
+
+		/// <summary>
+		/// Right-sizes the lookup table slots, the insertion order vector and the Datum buffers of this scope and every
+		/// scope below it, e.g. once a level has loaded. Nothing moves that outstanding references point to.
+		/// </summary>
+		void Compact();
+
+		/// <summary>
+		/// Hashes the names, types and elements of this scope and of every scope below it, in order, so that equal scopes
+		/// hash equal and operator== rejects most mismatches without walking the trees. The hash is cached and goes stale on
+		/// any write through a Datum of the scope or of a descendant. Externally stored attributes, and Datums that have
+		/// handed out a mutable reference or span, can change behind the scope's back, so they are rehashed on every call
+		/// and operator== does not use the hash of a scope holding them.
+		/// </summary>
+		/// <returns>Structural hash of the tree</returns>
+		size_t StructuralHash() const;
+
 	protected:
 		
-		const Vector<std::pair<std::string, Datum>*> GetPointersList() const;
+		AttributeSpan GetPointersList() const;
 		void RecursivelyCopyChilden(const Scope& rhs);
 		void FixParentPointers(Scope&& rhs);
 		void Orphan();
+		void AttachChild(Datum& datum, Scope& child);
+		bool HasValidParentSlot() const;
 
 		Scope* mParent = nullptr;
+
+		/// <summary>
+		/// Table datum of the parent holding this scope and the raw index of its slot, which counts tombstones the table
+		/// has not removed yet. Datums live in nodes the lookup table never relocates, so the pointer stays valid for as
+		/// long as the parent keeps the entry.
+		/// </summary>
+		Datum* mParentDatum = nullptr;
+		size_t mParentIndex = 0;
 		LookupTable mLookupTable;
 		PointersVector mPointersVector;
 
+	private:
+		friend class Datum;
+
+		void InvalidateStructuralHash();
+
+		/// <summary>
+		/// Brings the cached hash up to date and tells whether it covers every entry, i.e. the scope has no volatile ones
+		/// </summary>
+		/// <returns>True if StructuralHash is the cached value</returns>
+		bool HasStableStructuralHash() const;
+		static size_t HashEntry(size_t position, const LookupTableEntry& entry, bool& isVolatile);
+		static bool IsVolatileEntry(const LookupTableEntry& entry);
+
+		/// <summary>
+		/// Sum of the hashes of the entries that cannot change without this scope being told, valid until a write marks it stale
+		/// </summary>
+		mutable size_t mStructuralHash = 0;
+		mutable bool mIsStructuralHashValid = false;
+		mutable bool mHasVolatileEntries = false;
 	};
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "Sector.h"
 #include "Factory.h"
+#include "PrototypeRegistry.h"
 
 namespace Library
 {
@@ -28,18 +29,21 @@ namespace Library
 
 	Datum& Sector::Entities()
 	{
-		return mPointersVector[EntitiesIndex]->second;
+		return PrescribedAttribute(EntitiesIndex);
 	}
 
 	Entity* Sector::CreateEntity(const std::string& className, const std::string& instanceName)
 	{
-		Entity* entity = Factory<Scope>::Create(className)->As<Entity>();
+		const Scope* prototype = PrototypeRegistry::Find(className);
+		Scope* scope = (prototype != nullptr) ? prototype->CloneShared() : Factory<Scope>::Create(className);
+		Entity* entity = scope->As<Entity>();
 		if (entity != nullptr)
 		{
 			entity->SetName(instanceName);
 			entity->SetSector(this);
 			return entity;
 		}
+		delete scope;
 		return nullptr;
 	}
 
@@ -81,8 +85,8 @@ namespace Library
 	{
 		return Vector<Signature>
 		{
-			{ "Name", Datum::DatumType::STRING, 1, offsetof(Sector, mSectorName) },
-			{ "Entities", Datum::DatumType::TABLE, 0, 0 }
+			PRESCRIBED_ATTRIBUTE(Sector, "Name", mSectorName),
+			MakeTableSignature("Entities")
 		};
 	}
 }
\ No newline at end of file
@@ -15,6 +15,9 @@ namespace Library
 		RTTI_DECLARATIONS(Sector, Attributed)
 
 	public:
+		static constexpr size_t NameIndex = Attributed::PrescribedSlotCount;
+		static constexpr size_t EntitiesIndex = NameIndex + 1;
+		static constexpr size_t PrescribedSlotCount = EntitiesIndex + 1;
 
 		/// <summary> Constructor for Sector</summary>
 		Sector();
@@ -63,7 +66,7 @@ namespace Library
 		Datum& Entities();
 
 		/// <summary>
-		/// Uses the entity factory to make a new object, 
+		/// Clones the prototype registered under the class name, or uses the entity factory when there is none, to make a new object, 
 		/// adopts the entity into the sector, 
 		/// and returns the address of the new entity.
 		/// </summary>
@@ -99,8 +102,6 @@ namespace Library
 		static Vector<Signature> Signatures();
 
 	private:
-		static const size_t EntitiesIndex = 2;
-
 		std::string mSectorName;
 	};
 
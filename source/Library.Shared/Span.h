@@ -0,0 +1,93 @@
+#pragma once
+#include <cstddef>
+#include <type_traits>
+
+namespace Library
+{
+	/// <summary>
+	/// Non-owning view over a contiguous run of T, e.g. part of a Vector. Copying a span copies two words and never
+	/// allocates. A span is invalidated by anything that reallocates or shrinks the storage it views.
+	/// </summary>
+	template <typename T>
+	class Span final
+	{
+	public:
+		using value_type = T;
+
+		/// <summary>
+		/// Default constructor, empty span
+		/// </summary>
+		Span() = default;
+
+		/// <summary>
+		/// Constructor
+		/// </summary>
+		/// <param name="data">Pointer to the first element</param>
+		/// <param name="size">Number of elements</param>
+		Span(T* data, size_t size);
+
+		/// <summary>
+		/// Converting constructor, e.g. from Span&lt;T&gt; to Span&lt;const T&gt;
+		/// </summary>
+		/// <param name="other">Span to view</param>
+		template <typename TOther, typename = std::enable_if_t<std::is_convertible_v<TOther(*)[], T(*)[]>>>
+		Span(const Span<TOther>& other);
+
+		/// <summary>
+		/// Gets reference to element at provided index
+		/// </summary>
+		/// <param name="index">Index</param>
+		/// <returns>Reference to element</returns>
+		T& operator[](size_t index) const;
+
+		/// <summary>
+		/// Gets reference to the first element
+		/// </summary>
+		/// <returns>Reference to element</returns>
+		T& Front() const;
+
+		/// <summary>
+		/// Gets reference to the last element
+		/// </summary>
+		/// <returns>Reference to element</returns>
+		T& Back() const;
+
+		/// <summary>
+		/// Provides number of elements in the span
+		/// </summary>
+		/// <returns>Size of the span</returns>
+		size_t Size() const;
+
+		/// <summary>
+		/// Checks whether the span is empty
+		/// </summary>
+		/// <returns>True if span has no elements</returns>
+		bool IsEmpty() const;
+
+		/// <summary>
+		/// Provides a view of part of this span
+		/// </summary>
+		/// <param name="offset">Index of the first element of the subspan</param>
+		/// <param name="count">Number of elements, clamped to the end of the span</param>
+		/// <returns>Subspan</returns>
+		Span Subspan(size_t offset, size_t count = static_cast<size_t>(-1)) const;
+
+		/// <summary>
+		/// Pointer to the first element, for range-based for loops
+		/// </summary>
+		/// <returns>Pointer to the first element</returns>
+		T* begin() const;
+
+		/// <summary>
+		/// Pointer past the last element, for range-based for loops
+		/// </summary>
+		/// <returns>Pointer past the last element</returns>
+		T* end() const;
+
+	private:
+		T* mData = nullptr;
+		size_t mSize = 0;
+	};
+}
+
+#include "Span.inl"
@@ -0,0 +1,80 @@
+#include "Span.h"
+
+namespace Library
+{
+	template <typename T>
+	inline Span<T>::Span(T* data, size_t size) : mData(data), mSize(size)
+	{
+	}
+
+	template <typename T>
+	template <typename TOther, typename>
+	inline Span<T>::Span(const Span<TOther>& other) : mData(other.begin()), mSize(other.Size())
+	{
+	}
+
+	template <typename T>
+	inline T& Span<T>::operator[](size_t index) const
+	{
+		if (index >= mSize)
+		{
+			throw std::runtime_error("Index is out of bounds");
+		}
+		return mData[index];
+	}
+
+	template <typename T>
+	inline T& Span<T>::Front() const
+	{
+		if (mSize == 0)
+		{
+			throw std::runtime_error("Span is empty");
+		}
+		return mData[0];
+	}
+
+	template <typename T>
+	inline T& Span<T>::Back() const
+	{
+		if (mSize == 0)
+		{
+			throw std::runtime_error("Span is empty");
+		}
+		return mData[mSize - 1];
+	}
+
+	template <typename T>
+	inline size_t Span<T>::Size() const
+	{
+		return mSize;
+	}
+
+	template <typename T>
+	inline bool Span<T>::IsEmpty() const
+	{
+		return (mSize == 0);
+	}
+
+	template <typename T>
+	inline Span<T> Span<T>::Subspan(size_t offset, size_t count) const
+	{
+		if (offset > mSize)
+		{
+			throw std::runtime_error("Offset is out of bounds");
+		}
+		size_t remaining = mSize - offset;
+		return Span(mData + offset, (count < remaining ? count : remaining));
+	}
+
+	template <typename T>
+	inline T* Span<T>::begin() const
+	{
+		return mData;
+	}
+
+	template <typename T>
+	inline T* Span<T>::end() const
+	{
+		return mData + mSize;
+	}
+}
@@ -3,16 +3,65 @@
 
 namespace Library
 {
-	HashMap<size_t, Vector<Signature>> TypeRegistry::type_hashmap;
+	TypeRegistry::Table<size_t, Vector<Signature>> TypeRegistry::type_hashmap;
+	TypeRegistry::Table<size_t, TypeRegistry::Table<std::string, size_t>> TypeRegistry::prescribed_hashmap;
+	TypeRegistry::Table<size_t, Vector<InternedString>> TypeRegistry::prescribed_names;
 
 	void TypeRegistry::RegisterType(const RTTI::IdType typeID, const Vector<Signature>& signatures)
 	{
+		//"this" is appended before the signatures, so signature i sits at position i + 1. A repeated name would leave
+		//fewer names than slots and shift every attribute after it, so nothing is registered.
+		Table<std::string, size_t> prescribed(signatures.Size() + 1);
+		Vector<InternedString> names(signatures.Size() + 1);
+		prescribed.Insert(std::make_pair(std::string("this"), size_t(0)));
+		names.EmplaceBack("this");
+		for (size_t i = 0; i < signatures.Size(); ++i)
+		{
+			bool inserted;
+			prescribed.Insert(std::make_pair(signatures[i].name, i + 1), inserted);
+			if (!inserted)
+			{
+				throw std::runtime_error("Prescribed attribute names must be unique!");
+			}
+			names.EmplaceBack(signatures[i].name);
+		}
 		type_hashmap.Insert(std::make_pair(typeID, signatures));
+		prescribed_hashmap.Insert(std::make_pair(typeID, prescribed));
+		prescribed_names.Insert(std::make_pair(typeID, std::move(names)));
 	}
 
 	void TypeRegistry::UnregisterType(const RTTI::IdType typeID)
 	{
 		type_hashmap.Remove(typeID);
+		prescribed_hashmap.Remove(typeID);
+		prescribed_names.Remove(typeID);
+	}
+
+	bool TypeRegistry::IsPrescribedAttribute(const RTTI::IdType typeID, std::string_view name)
+	{
+		const Table<std::string, size_t>& prescribed = prescribed_hashmap.At(typeID);
+		return (prescribed.Find(name) != prescribed.end());
+	}
+
+	size_t TypeRegistry::PrescribedAttributeCount(const RTTI::IdType typeID)
+	{
+		return prescribed_hashmap.At(typeID).Size();
+	}
+
+	size_t TypeRegistry::PrescribedAttributeIndex(const RTTI::IdType typeID, std::string_view name)
+	{
+		const Table<std::string, size_t>& prescribed = prescribed_hashmap.At(typeID);
+		auto iter = prescribed.Find(name);
+		if (iter == prescribed.end())
+		{
+			throw std::runtime_error("Provided name is not a prescribed attribute of the type!");
+		}
+		return iter->second;
+	}
+
+	const Vector<InternedString>& TypeRegistry::GetPrescribedNames(const RTTI::IdType typeID)
+	{
+		return prescribed_names.At(typeID);
 	}
 
 	Vector<Signature>& TypeRegistry::GetSignatures(const RTTI::IdType typeID)
@@ -23,5 +72,7 @@ namespace Library
 	void TypeRegistry::Clear()
 	{
 		type_hashmap.Clear();
+		prescribed_hashmap.Clear();
+		prescribed_names.Clear();
 	}
 }
\ No newline at end of file
@@ -1,6 +1,10 @@
 #pragma once
 #include "Datum.h"
-#include "HashMap.h"
+#include "FlatHashMap.h"
+#include "InternedString.h"
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
 
 namespace Library
 {
@@ -15,6 +19,52 @@ namespace Library
 		size_t offset;
 	};
 
+	/// <summary>
+	/// Maps a C++ member type to the Datum type that can bind to it as external storage. Unsupported member types
+	/// fail to compile instead of silently binding storage of the wrong size.
+	/// </summary>
+	template <typename T>
+	struct DatumTypeOf
+	{
+		static_assert(sizeof(T) == 0, "Member type has no matching Datum type");
+	};
+
+	template <> struct DatumTypeOf<std::int32_t> : std::integral_constant<Datum::DatumType, Datum::DatumType::INTEGER> {};
+	template <> struct DatumTypeOf<float> : std::integral_constant<Datum::DatumType, Datum::DatumType::FLOAT> {};
+	template <> struct DatumTypeOf<glm::vec4> : std::integral_constant<Datum::DatumType, Datum::DatumType::VECTOR4> {};
+	template <> struct DatumTypeOf<glm::mat4> : std::integral_constant<Datum::DatumType, Datum::DatumType::MATRIX4X4> {};
+	template <> struct DatumTypeOf<std::string> : std::integral_constant<Datum::DatumType, Datum::DatumType::STRING> {};
+	template <> struct DatumTypeOf<RTTI*> : std::integral_constant<Datum::DatumType, Datum::DatumType::POINTER> {};
+	template <typename T, size_t N> struct DatumTypeOf<T[N]> : DatumTypeOf<T> {};
+
+	/// <summary>
+	/// Builds the signature of an externally stored member, deducing its Datum type and element count from the member type
+	/// </summary>
+	/// <param name="name">Name of the attribute</param>
+	/// <param name="offset">Offset of the member within the class</param>
+	/// <returns>Signature of the member</returns>
+	template <typename TMember>
+	inline Signature MakeSignature(std::string name, size_t offset)
+	{
+		return Signature{ std::move(name), DatumTypeOf<TMember>::value, std::max<size_t>(std::extent_v<TMember>, 1), offset };
+	}
+
+	/// <summary>
+	/// Builds the signature of a nested table attribute, which has no external storage
+	/// </summary>
+	/// <param name="name">Name of the attribute</param>
+	/// <param name="size">Number of scopes appended when the attribute is populated</param>
+	/// <returns>Signature of the table</returns>
+	inline Signature MakeTableSignature(std::string name, size_t size = 0)
+	{
+		return Signature{ std::move(name), Datum::DatumType::TABLE, size, 0 };
+	}
+
+	/// <summary>
+	/// Declares a prescribed attribute from a data member, e.g. PRESCRIBED_ATTRIBUTE(Entity, "Name", mEntityName)
+	/// </summary>
+#define PRESCRIBED_ATTRIBUTE(Class, Name, Member) Library::MakeSignature<decltype(Class::Member)>(Name, offsetof(Class, Member))
+
 	/// <summary>
 	/// Singleton registry that holds hashmap of all prescribed signatures
 	/// </summary>
@@ -28,7 +78,7 @@ namespace Library
 		TypeRegistry& operator=(TypeRegistry&& rhs) = delete;
 
 		/// <summary>
-		/// Static function to register prescribed attributes
+		/// Static function to register prescribed attributes, throws if two of them (or one and "this") share a name
 		/// </summary>
 		/// <param name="typeID">Const RTTI ID Type</param>
 		/// <param name="signatures">Const reference to vector of signatures</param>
@@ -46,6 +96,38 @@ namespace Library
 		/// <param name="typeID">Const RTTI ID Type</param>
 		/// <returns>Vector of prescribed signatures</returns>
 		static Vector<Signature>& GetSignatures(const RTTI::IdType typeID);
+
+		/// <summary>
+		/// Checks whether a name is a prescribed attribute of a type, "this" included, with a single hash lookup
+		/// </summary>
+		/// <param name="typeID">Const RTTI ID Type</param>
+		/// <param name="name">Name of the attribute</param>
+		/// <returns>True if the type prescribes the attribute</returns>
+		static bool IsPrescribedAttribute(const RTTI::IdType typeID, std::string_view name);
+
+		/// <summary>
+		/// Provides the number of prescribed attributes of a type, "this" included. Attributed populates them first and in
+		/// signature order, so they occupy exactly this many leading entries of the scope.
+		/// </summary>
+		/// <param name="typeID">Const RTTI ID Type</param>
+		/// <returns>Number of prescribed attributes</returns>
+		static size_t PrescribedAttributeCount(const RTTI::IdType typeID);
+
+		/// <summary>
+		/// Provides the slot a prescribed attribute occupies in every instance of a type, "this" being slot 0
+		/// </summary>
+		/// <param name="typeID">Const RTTI ID Type</param>
+		/// <param name="name">Name of the attribute</param>
+		/// <returns>Slot index of the attribute</returns>
+		static size_t PrescribedAttributeIndex(const RTTI::IdType typeID, std::string_view name);
+
+		/// <summary>
+		/// Provides the interned names of the prescribed attributes of a type in scope order, "this" first. Their hashes
+		/// are computed once at registration, so populating an instance never hashes an attribute name.
+		/// </summary>
+		/// <param name="typeID">Const RTTI ID Type</param>
+		/// <returns>Interned prescribed attribute names</returns>
+		static const Vector<InternedString>& GetPrescribedNames(const RTTI::IdType typeID);
 		
 		/// <summary>
 		/// Clears the registry (the hashmap)
@@ -53,6 +135,23 @@ namespace Library
 		static void Clear();
 
 	private:
-		static HashMap<size_t, Vector<Signature>> type_hashmap;
+		/// <summary>
+		/// Map used for every table of the registry. The registry is a class of statics shared by every Attributed type,
+		/// so the container is chosen here rather than through a template parameter; any map with the HashMap interface fits.
+		/// </summary>
+		template <typename TKey, typename TData>
+		using Table = FlatHashMap<TKey, TData>;
+
+		static Table<size_t, Vector<Signature>> type_hashmap;
+
+		/// <summary>
+		/// Per type, maps every prescribed attribute name to its position in the scope, built when the type is registered
+		/// </summary>
+		static Table<size_t, Table<std::string, size_t>> prescribed_hashmap;
+
+		/// <summary>
+		/// Per type, the interned prescribed attribute names in scope order
+		/// </summary>
+		static Table<size_t, Vector<InternedString>> prescribed_names;
 	};
 }
\ No newline at end of file
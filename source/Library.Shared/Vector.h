@@ -5,19 +5,24 @@
 #include <exception>
 #include <functional>
 #include <initializer_list>
+#include <type_traits>
+#include <utility>
+#include <algorithm>
+#include "MemoryResource.h"
+#include "GrowthStrategy.h"
+#include "Span.h"
+#include "MemoryFootprint.h"
 
 namespace Library
 {
-	
 	/// <summary>
-	/// Default reserve strategy
+	/// Whether a T may be moved to a new address bytewise (memcpy/realloc). Defaults to trivially copyable types,
+	/// specialize it for types known to be safe; everything else is move constructed into the new block.
 	/// </summary>
-	class IncrementStrategy final
+	template <typename T>
+	struct IsTriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<T>>
 	{
-	public:
-		size_t operator()(size_t size, size_t capacity) const;
 	};
-
 	template <typename T>
 
 	/// <summary>
@@ -30,6 +35,26 @@ namespace Library
 		size_t mSize{ 0 };
 		size_t mCapacity{ 0 };
 		T* mData{ nullptr };
+		MemoryResource* mResource{ &MemoryResource::Default() };
+		GrowthStrategy mGrowthStrategy{ GrowthStrategyGuard::Current(&IncrementStrategy::Grow) };
+
+		/// <summary>
+		/// Provides the capacity a full vector grows to according to the growth strategy
+		/// </summary>
+		/// <returns>New capacity</returns>
+		size_t NextCapacity() const;
+
+		/// <summary>
+		/// Moves the elements into a block of the given capacity, bytewise for trivially relocatable types
+		/// </summary>
+		/// <param name="newCapacity">Capacity of the new block, at least the size</param>
+		void Relocate(size_t newCapacity);
+
+		/// <summary>
+		/// Move constructs the elements into a new block and destroys the originals, copies instead if moving may throw
+		/// </summary>
+		/// <param name="data">Block to move the elements into</param>
+		void MoveElements(T* data);
 
 	public:
 
@@ -234,6 +259,13 @@ namespace Library
 		/// <param name="capacity">Initial capacity</param>
 		explicit Vector(size_t capacity = 0);
 
+		/// <summary>
+		/// Constructor that allocates from the provided resource instead of the default one
+		/// </summary>
+		/// <param name="resource">Resource the elements are allocated from</param>
+		/// <param name="capacity">Initial capacity</param>
+		explicit Vector(MemoryResource& resource, size_t capacity = 0);
+
 		Vector(std::initializer_list<T> list);
 
 		/// <summary>
@@ -262,11 +294,29 @@ namespace Library
 		Vector& operator=(const Vector& rhs);
 
 		/// <summary>
-		/// Copy constructor
+		/// Copy constructor, the copy allocates from the default resource
 		/// </summary>
 		/// <param name="rhs">Const reference to the vector that's being copied</param>
 		Vector(const Vector& rhs);
 
+		/// <summary>
+		/// Provides the resource the elements are allocated from
+		/// </summary>
+		/// <returns>Reference to the memory resource</returns>
+		MemoryResource& Resource() const;
+
+		/// <summary>
+		/// Provides the strategy used to grow a full vector
+		/// </summary>
+		/// <returns>Growth strategy</returns>
+		GrowthStrategy GetGrowthStrategy() const;
+
+		/// <summary>
+		/// Replaces the strategy used to grow a full vector, copies and moves carry it along
+		/// </summary>
+		/// <param name="strategy">New growth strategy</param>
+		void SetGrowthStrategy(GrowthStrategy strategy);
+
 
 		/// <summary>
 		/// Gets reference to element at provided index
@@ -309,6 +359,11 @@ namespace Library
 		/// </summary>
 		Iterator PushBack(const T& data);
 
+		/// <summary>
+		/// Moves item to the end of the vector
+		/// </summary>
+		Iterator PushBack(T&& data);
+
 		/// <summary>
 		/// Empties the vector, resets capacity to 0
 		/// </summary>
@@ -330,6 +385,30 @@ namespace Library
 		/// <returns>True if vector is empty</returns>
 		bool IsEmpty() const;
 
+		/// <summary>
+		/// Provides pointer to the contiguous elements
+		/// </summary>
+		/// <returns>Pointer to the first element, nullptr if nothing was ever allocated</returns>
+		T* Data();
+
+		/// <summary>
+		/// Provides pointer to the contiguous elements
+		/// </summary>
+		/// <returns>Const pointer to the first element, nullptr if nothing was ever allocated</returns>
+		const T* Data() const;
+
+		/// <summary>
+		/// Provides a non-owning view of the elements, invalidated when the vector reallocates or shrinks
+		/// </summary>
+		/// <returns>Span over the elements</returns>
+		Span<T> AsSpan();
+
+		/// <summary>
+		/// Provides a non-owning read-only view of the elements, invalidated when the vector reallocates or shrinks
+		/// </summary>
+		/// <returns>Span over the elements</returns>
+		Span<const T> AsSpan() const;
+
 		/// <summary>
 		/// Gets the size of the vector (number of T items in the vector)		/// </summary>
 		/// <returns>Size of the vector as unsigned int</returns>
@@ -341,6 +420,12 @@ namespace Library
 		/// <returns>Capacity of the vector as an unsigned int</returns>
 		size_t Capacity() const;
 
+		/// <summary>
+		/// Reports the bytes of the element block, heap owned by the elements themselves is not followed
+		/// </summary>
+		/// <returns>Elements and capacity slack in bytes</returns>
+		MemoryFootprint Footprint() const;
+
 		/// <summary>
 		/// Gets an Iterator pointing to the vector's first element
 		/// </summary>
@@ -449,6 +534,12 @@ namespace Library
 
 		bool Remove(const Iterator& iter);
 
+		/// <summary>
+		/// Constructs an element in place at the end of the vector, the arguments are forwarded and never copied.
+		/// The arguments may refer to elements of the vector itself.
+		/// </summary>
+		/// <param name="args">Constructor arguments</param>
+		/// <returns>Iterator pointing to the new element</returns>
 		template <typename... Args>
 		Iterator EmplaceBack(Args&&... args);
 	};
@@ -4,25 +4,16 @@
 
 namespace Library
 {
-#pragma region IncrementStrategy
+#pragma region Vector
 
-	inline size_t IncrementStrategy::operator()(size_t size, size_t capacity) const
+	template <typename T>
+	inline Vector<T>::Vector(size_t capacity)
 	{
-		if (size == 0 && capacity == 0)
-		{
-			return 5;
-		}
-		return capacity * 2;
+		Reserve(capacity);
 	}
 
-#pragma endregion
-
-
-
-#pragma region Vector
-
 	template <typename T>
-	inline Vector<T>::Vector(size_t capacity)
+	inline Vector<T>::Vector(MemoryResource& resource, size_t capacity) : mResource(&resource)
 	{
 		Reserve(capacity);
 	}
@@ -37,9 +28,9 @@ namespace Library
 	}
 
 	template <typename T>
-	inline Vector<T>::Vector(const Vector& rhs) : mSize(rhs.mSize), mCapacity(rhs.mCapacity)
+	inline Vector<T>::Vector(const Vector& rhs) : mSize(rhs.mSize), mCapacity(rhs.mCapacity), mGrowthStrategy(rhs.mGrowthStrategy)
 	{
-		mData = static_cast<T*>(malloc(rhs.mCapacity * sizeof(T)));
+		mData = static_cast<T*>(mResource->Allocate(rhs.mCapacity * sizeof(T)));
 
 		for (size_t index = 0; index < rhs.mSize; ++index)
 		{
@@ -54,7 +45,7 @@ namespace Library
 	}
 
 	template <typename T>
-	inline Vector<T>::Vector(Vector&& rhs) : mSize(rhs.mSize), mCapacity(rhs.mCapacity), mData(rhs.mData)
+	inline Vector<T>::Vector(Vector&& rhs) : mSize(rhs.mSize), mCapacity(rhs.mCapacity), mData(rhs.mData), mResource(rhs.mResource), mGrowthStrategy(rhs.mGrowthStrategy)
 	{
 		rhs.mSize = 0;
 		rhs.mCapacity = 0;
@@ -71,6 +62,8 @@ namespace Library
 			mSize = rhs.mSize;
 			mCapacity = rhs.mCapacity;
 			mData = rhs.mData;
+			mResource = rhs.mResource;
+			mGrowthStrategy = rhs.mGrowthStrategy;
 
 			rhs.mSize = 0;
 			rhs.mCapacity = 0;
@@ -86,7 +79,7 @@ namespace Library
 		{
 			Wipe();
 
-			mData = static_cast<T*>(malloc(rhs.mCapacity * sizeof(T)));
+			mData = static_cast<T*>(mResource->Allocate(rhs.mCapacity * sizeof(T)));
 
 			for (size_t index = 0; index < rhs.mSize; ++index)
 			{
@@ -94,6 +87,7 @@ namespace Library
 			}
 			mSize = rhs.mSize;
 			mCapacity = rhs.mCapacity;
+			mGrowthStrategy = rhs.mGrowthStrategy;
 		}
 		return *this;
 	}
@@ -136,6 +130,30 @@ namespace Library
 		return (mSize == 0);
 	}
 
+	template <typename T>
+	inline T* Vector<T>::Data()
+	{
+		return mData;
+	}
+
+	template <typename T>
+	inline const T* Vector<T>::Data() const
+	{
+		return mData;
+	}
+
+	template <typename T>
+	inline Span<T> Vector<T>::AsSpan()
+	{
+		return Span<T>(mData, mSize);
+	}
+
+	template <typename T>
+	inline Span<const T> Vector<T>::AsSpan() const
+	{
+		return Span<const T>(mData, mSize);
+	}
+
 	template <typename T>
 	inline T& Vector<T>::Front()
 	{
@@ -212,7 +230,7 @@ namespace Library
 		Clear();
 		if (mCapacity != 0)
 		{
-			free(mData);
+			mResource->Deallocate(mData, mCapacity * sizeof(T));
 		}
 		mData = nullptr;
 		mCapacity = 0;
@@ -223,16 +241,19 @@ namespace Library
 	{
 		if (mCapacity > mSize)
 		{
-			T* prevData = mData;
-			mData = reinterpret_cast<T*>(malloc(mSize * sizeof(T)));
-			memcpy(mData, prevData, mSize * sizeof(T));
-			mCapacity = mSize;
-
-			free(prevData);
-			prevData = nullptr;
+			Relocate(mSize);
 		}
 	}
 
+	template <typename T>
+	inline MemoryFootprint Vector<T>::Footprint() const
+	{
+		MemoryFootprint footprint;
+		footprint.VectorElements = mSize * sizeof(T);
+		footprint.VectorSlack = (mCapacity - mSize) * sizeof(T);
+		return footprint;
+	}
+
 	template <typename T>
 	inline typename Vector<T>::Iterator Vector<T>::Find(const T& data)
 	{
@@ -266,20 +287,13 @@ namespace Library
 	template <typename T>
 	inline typename Vector<T>::Iterator Vector<T>::PushBack(const T& data)
 	{
-		if (mSize == mCapacity)
-		{
-			IncrementStrategy strat; 
-			size_t newCapacity = strat.operator()(mSize, mCapacity);
+		return EmplaceBack(data);
+	}
 
-			if (newCapacity < mCapacity)
-			{
-				throw std::runtime_error("Increment strategy fail! New capacity is less than current capacity!");
-			}
-			Reserve(newCapacity);
-		}
-		new (mData + mSize)T(data);
-		mSize++;
-		return Iterator(size_t(mSize - 1), *this);
+	template <typename T>
+	inline typename Vector<T>::Iterator Vector<T>::PushBack(T&& data)
+	{
+		return EmplaceBack(std::move(data));
 	}
 
 	template <typename T>
@@ -321,34 +335,120 @@ namespace Library
 	template <typename T>
 	inline void Vector<T>::Resize(size_t newSize)
 	{
-		if (newSize < mSize)
+		while (mSize > newSize)
+		{
+			mData[--mSize].~T();
+		}
+		if (newSize != mCapacity)
+		{
+			//Capacity always follows the new size
+			Relocate(newSize);
+		}
+		for (; mSize < newSize; ++mSize)
+		{
+			new (mData + mSize)T();
+		}
+	}
+
+	template <typename T>
+	inline void Vector<T>::Reserve(size_t newCapacity)
+	{	
+		if (newCapacity > mCapacity)
 		{
-			for (size_t i = newSize; i < mSize; ++i)
+			Relocate(newCapacity);
+		}
+	}
+
+	template <typename T>
+	inline void Vector<T>::Relocate(size_t newCapacity)
+	{
+		if (newCapacity == 0)
+		{
+			Wipe();
+			return;
+		}
+
+		if constexpr (IsTriviallyRelocatable<T>::value)
+		{
+			mData = static_cast<T*>(mResource->Reallocate(mData, mCapacity * sizeof(T), newCapacity * sizeof(T)));
+		}
+		else
+		{
+			T* data = static_cast<T*>(mResource->Allocate(newCapacity * sizeof(T)));
+			try
 			{
-				mData[i].~T();
+				MoveElements(data);
 			}
+			catch (...)
+			{
+				mResource->Deallocate(data, newCapacity * sizeof(T));
+				throw;
+			}
+			mResource->Deallocate(mData, mCapacity * sizeof(T));
+			mData = data;
 		}
-		if (newSize > mCapacity)
-		{
-			mData = reinterpret_cast<T*>(realloc(mData, sizeof(T) * newSize));
+		mCapacity = newCapacity;
+	}
 
-			for (size_t i = mSize; i < newSize; i++)
+	template <typename T>
+	inline void Vector<T>::MoveElements(T* data)
+	{
+		size_t constructed = 0;
+		try
+		{
+			for (; constructed < mSize; ++constructed)
+			{
+				new (data + constructed)T(std::move_if_noexcept(mData[constructed]));
+			}
+		}
+		catch (...)
+		{
+			//Only copies can throw, so the originals are intact
+			while (constructed > 0)
 			{
-				new (mData + i)T();
+				data[--constructed].~T();
 			}
+			throw;
+		}
+
+		for (size_t i = 0; i < mSize; ++i)
+		{
+			mData[i].~T();
 		}
-		mSize = newSize;
-		mCapacity = newSize;
 	}
 
 	template <typename T>
-	inline void Vector<T>::Reserve(size_t newCapacity)
-	{	
-		if (newCapacity > mCapacity)
+	inline MemoryResource& Vector<T>::Resource() const
+	{
+		return *mResource;
+	}
+
+	template <typename T>
+	inline GrowthStrategy Vector<T>::GetGrowthStrategy() const
+	{
+		return mGrowthStrategy;
+	}
+
+	template <typename T>
+	inline void Vector<T>::SetGrowthStrategy(GrowthStrategy strategy)
+	{
+		if (strategy == nullptr)
+		{
+			throw std::runtime_error("Growth strategy cannot be null!");
+		}
+		mGrowthStrategy = strategy;
+	}
+
+	template <typename T>
+	inline size_t Vector<T>::NextCapacity() const
+	{
+		size_t newCapacity = mGrowthStrategy(mSize, mCapacity);
+
+		if (newCapacity <= mCapacity)
 		{
-			mData = reinterpret_cast<T*>(realloc(mData, newCapacity * sizeof(T)));
-			mCapacity = newCapacity;
+			throw std::runtime_error("Increment strategy fail! New capacity is less than current capacity!");
 		}
+		return newCapacity;
 	}
 
 	template <typename T>
@@ -395,16 +495,29 @@ namespace Library
 		size_t startingIndex = beginning.mIndex;
 		size_t endingIndex = ending.mIndex;
 
-		for (Iterator iter = beginning; iter != ending; ++iter)
+		if constexpr (IsTriviallyRelocatable<T>::value)
 		{
-			(*iter).~T();
-		}
+			for (Iterator iter = beginning; iter != ending; ++iter)
+			{
+				(*iter).~T();
+			}
 
-		T* dest = mData + startingIndex;
-		T* src = mData + endingIndex;
+			T* dest = mData + startingIndex;
+			T* src = mData + endingIndex;
 
-		memmove_s(dest, sizeof(T) * (mSize - endingIndex), src, sizeof(T) * (mSize - endingIndex));
-		mSize -= (endingIndex - startingIndex);
+			memmove_s(dest, sizeof(T) * (mSize - endingIndex), src, sizeof(T) * (mSize - endingIndex));
+			mSize -= (endingIndex - startingIndex);
+		}
+		else
+		{
+			//Shift the tail down by move assignment, then destroy the moved-from elements left at the end
+			std::move(mData + endingIndex, mData + mSize, mData + startingIndex);
+			size_t newSize = mSize - (endingIndex - startingIndex);
+			while (mSize > newSize)
+			{
+				mData[--mSize].~T();
+			}
+		}
 
 		return true;
 	}
@@ -415,16 +528,48 @@ namespace Library
 	{
 		if (mSize == mCapacity)
 		{
-			IncrementStrategy strat;
-			size_t newCapacity = strat.operator()(mSize, mCapacity);
-
-			if (newCapacity < mCapacity)
+			size_t newCapacity = NextCapacity();
+			if constexpr (IsTriviallyRelocatable<T>::value)
 			{
-				throw std::runtime_error("Increment strategy fail! New capacity is less than current capacity!");
+				//The arguments may refer into the old block, so build the element before the block moves
+				T value(std::forward<Args>(args)...);
+				Relocate(newCapacity);
+				new (mData + mSize)T(std::move(value));
 			}
-			Reserve(newCapacity);
+			else
+			{
+				//Construct the new element in the new block first, the arguments may refer into the old one
+				T* data = static_cast<T*>(mResource->Allocate(newCapacity * sizeof(T)));
+				try
+				{
+					new (data + mSize)T(std::forward<Args>(args)...);
+					try
+					{
+						MoveElements(data);
+					}
+					catch (...)
+					{
+						data[mSize].~T();
+						throw;
+					}
+				}
+				catch (...)
+				{
+					mResource->Deallocate(data, newCapacity * sizeof(T));
+					throw;
+				}
+				if (mCapacity != 0)
+				{
+					mResource->Deallocate(mData, mCapacity * sizeof(T));
+				}
+				mData = data;
+				mCapacity = newCapacity;
+			}
+		}
+		else
+		{
+			new (mData + mSize)T(std::forward<Args>(args)...);
 		}
-		new (mData + mSize)T(std::forward<Args>(args)...);
 		++mSize;
 		return Iterator(mSize - 1, *this);
 	}
@@ -5,6 +5,11 @@ namespace Library
 {
 	RTTI_DEFINITIONS(World)
 
+	namespace
+	{
+		const InternedString ReactionsName("Reactions");
+	}
+
 	World::World() : Attributed(TypeIdInstance())
 	{
 
@@ -32,7 +37,7 @@ namespace Library
 
 	Datum& World::Sectors()
 	{
-		return mPointersVector[SectorsIndex]->second;
+		return PrescribedAttribute(SectorsIndex);
 	}
 
 	Sector* World::CreateSector(const std::string& sectorName)
@@ -68,8 +73,8 @@ namespace Library
 	{
 		return Vector<Signature>
 		{
-			{ "Name", Datum::DatumType::STRING, 1, offsetof(World, mWorldName)},
-			{ "Sectors", Datum::DatumType::TABLE, 0, 0 }
+			PRESCRIBED_ATTRIBUTE(World, "Name", mWorldName),
+			MakeTableSignature("Sectors")
 		};
 	}
 
@@ -101,7 +106,7 @@ namespace Library
 
 	Datum& World::Reactions()
 	{
-		return (*this)["Reactions"];
+		return (*this)[ReactionsName];
 	}
 
 	Reaction* World::CreateReaction(const std::string& name)
@@ -21,6 +21,9 @@ namespace Library
 		RTTI_DECLARATIONS(World, Attributed)
 
 	public:
+		static constexpr size_t NameIndex = Attributed::PrescribedSlotCount;
+		static constexpr size_t SectorsIndex = NameIndex + 1;
+		static constexpr size_t PrescribedSlotCount = SectorsIndex + 1;
 
 		/// <summary> Constructor for World</summary>
 		World();
@@ -104,8 +107,6 @@ namespace Library
 		Reaction* CreateReaction(const std::string& name);
 
 	private:
-		static const size_t SectorsIndex = 2;
-
 		std::string mWorldName;
 
 		Vector<Scope*> mDeletionList{ 10 };
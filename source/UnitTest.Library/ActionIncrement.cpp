@@ -1,6 +1,7 @@
 
 #include "pch.h"
 #include "ActionIncrement.h"
+#include "DatumRef.h"
 
 using namespace Library;
 
@@ -23,14 +24,15 @@ namespace UnitTests
 
 		if (mReference->Type() == Datum::DatumType::INTEGER)
 		{
-			mReference->Datum::Get<int32_t>()++;
+			DatumRef<int32_t> counter(*mReference);
+			++counter[0];
 		}
 	}
 
 	Vector<Signature> ActionIncrement::Signatures()
 	{
 		Vector<Signature> signatures = Action::Signatures();
-		signatures.PushBack({ "Target", Datum::DatumType::STRING, 1, offsetof(ActionIncrement, mTarget) });
+		signatures.PushBack(PRESCRIBED_ATTRIBUTE(ActionIncrement, "Target", mTarget));
 		return signatures;
 	}
 
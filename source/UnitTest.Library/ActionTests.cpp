@@ -1,4 +1,5 @@
 #include "pch.h"
+#include "PrototypeRegistry.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace Library;
@@ -80,6 +81,7 @@ namespace UnitTests
 
 		TEST_METHOD_CLEANUP(Cleanup)
 		{
+			ObjectPool::Trim();
 #if defined(DEBUG) || defined(_DEBUG)
 			_CrtMemState end_mem_state, diff_mem_state;
 			_CrtMemCheckpoint(&end_mem_state);
@@ -198,6 +200,25 @@ namespace UnitTests
 			Assert::AreEqual(entity, actionIncrement->GetEntity()->As<Entity>());
 		}
 
+		TEST_METHOD(CreateActionFromOtherPrototype)
+		{
+			//A prototype registered under the class name that is not an Action is rejected and its clone deleted
+			PrototypeRegistry::Register("Crate", new Scope());
+			World world("TestWorld");
+			Entity entity("TestEntity");
+			WorldState worldState;
+			worldState.World = &world;
+			worldState.Entity = &entity;
+			ActionCreateAction* createAction = new ActionCreateAction("CreateLid");
+			entity.Adopt(*createAction, "Actions");
+			createAction->SetClassName("Crate");
+			createAction->SetInstanceName("Lid");
+			auto expression = [&] { createAction->Update(worldState); };
+			Assert::ExpectException<std::runtime_error>(expression);
+			Assert::AreEqual<size_t>(1, entity.Actions().Size());
+			PrototypeRegistry::Clear();
+		}
+
 		TEST_METHOD(Updates)
 		{
 			GameTime gameTime;
@@ -36,18 +36,18 @@ namespace Library
 	{
 		return Vector<Signature>
 		{
-			{ "ExternalInteger", Datum::DatumType::INTEGER, 1, offsetof(AttributedFoo, external_integer) },
-			{ "ExternalFloat", Datum::DatumType::FLOAT, 1, offsetof(AttributedFoo,external_float) },
-			{ "ExternalString", Datum::DatumType::STRING, 1, offsetof(AttributedFoo,external_string) },
-			{ "ExternalVector", Datum::DatumType::VECTOR4, 1, offsetof(AttributedFoo,external_vector) },
-			{ "ExternalMatrix", Datum::DatumType::MATRIX4X4, 1, offsetof(AttributedFoo,external_matrix) },
-			{ "ExternalIntegerArray", Datum::DatumType::INTEGER, SIZE_OF_ARRAY, offsetof(AttributedFoo,external_integer_array) },
-			{ "ExternalFloatArray", Datum::DatumType::FLOAT, SIZE_OF_ARRAY, offsetof(AttributedFoo,external_float_array) },
-			{ "ExternalStringArray", Datum::DatumType::STRING, SIZE_OF_ARRAY, offsetof(AttributedFoo,external_string_array) },
-			{ "ExternalVectorArray", Datum::DatumType::VECTOR4, SIZE_OF_ARRAY, offsetof(AttributedFoo,external_vector_array) },
-			{ "ExternalMatrixArray", Datum::DatumType::MATRIX4X4, SIZE_OF_ARRAY, offsetof(AttributedFoo,external_matrix_array) },
-			{ "NestedScope", Datum::DatumType::TABLE, 0, 0 },
-			{ "NestedScopes", Datum::DatumType::TABLE, SIZE_OF_ARRAY, 0 }
+			PRESCRIBED_ATTRIBUTE(AttributedFoo, "ExternalInteger", external_integer),
+			PRESCRIBED_ATTRIBUTE(AttributedFoo, "ExternalFloat", external_float),
+			PRESCRIBED_ATTRIBUTE(AttributedFoo, "ExternalString", external_string),
+			PRESCRIBED_ATTRIBUTE(AttributedFoo, "ExternalVector", external_vector),
+			PRESCRIBED_ATTRIBUTE(AttributedFoo, "ExternalMatrix", external_matrix),
+			PRESCRIBED_ATTRIBUTE(AttributedFoo, "ExternalIntegerArray", external_integer_array),
+			PRESCRIBED_ATTRIBUTE(AttributedFoo, "ExternalFloatArray", external_float_array),
+			PRESCRIBED_ATTRIBUTE(AttributedFoo, "ExternalStringArray", external_string_array),
+			PRESCRIBED_ATTRIBUTE(AttributedFoo, "ExternalVectorArray", external_vector_array),
+			PRESCRIBED_ATTRIBUTE(AttributedFoo, "ExternalMatrixArray", external_matrix_array),
+			MakeTableSignature("NestedScope"),
+			MakeTableSignature("NestedScopes", SIZE_OF_ARRAY)
 		};
 	}
 }
\ No newline at end of file
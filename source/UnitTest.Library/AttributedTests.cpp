@@ -45,6 +45,7 @@ namespace UnitTestLibraryDesktop
 
 		TEST_METHOD_CLEANUP(Cleanup)
 		{
+			ObjectPool::Trim();
 
 #if defined(DEBUG) || defined(_DEBUG)
 			_CrtMemState end_mem_state, diff_mem_state;
@@ -259,7 +260,7 @@ namespace UnitTestLibraryDesktop
 			af["ExternalInteger"].Get<int32_t>() = 123;
 			af["ExternalFloat"].Get<float_t>() = 1.23f;
 
-			Vector<std::pair<std::string, Datum>*> attributes = af.GetAttributes();
+			Scope::AttributeSpan attributes = af.GetAttributes();
 			Assert::AreEqual<size_t>(13, attributes.Size());
 
 			Assert::AreEqual("this"s, attributes[0]->first);
@@ -277,6 +278,99 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual("NestedScopes"s, attributes[12]->first);
 		}
 
+		TEST_METHOD(PrescribedAttributeCount)
+		{
+			AttributedFoo af;
+			Assert::AreEqual<size_t>(13, af.PrescribedAttributeCount());
+
+			af.AppendAuxiliaryAttribute("AuxInt") = 10;
+			af.AppendAuxiliaryAttribute("AuxFloat") = 1.5f;
+			Scope::AttributeSpan attributes = af.GetAttributes();
+			Assert::IsTrue(attributes.begin() == af.GetAttributes().begin());
+			Assert::AreEqual<size_t>(15, attributes.Size());
+			for (size_t i = 0; i < attributes.Size(); ++i)
+			{
+				Assert::AreEqual(i < af.PrescribedAttributeCount(), af.IsPrescribedAttribute(attributes[i]->first));
+			}
+
+			Scope::AttributeSpan prescribed = af.GetPrescribedAttributes();
+			Assert::AreEqual<size_t>(13, prescribed.Size());
+			Assert::AreEqual("this"s, prescribed.Front()->first);
+			Assert::AreEqual("NestedScopes"s, prescribed.Back()->first);
+
+			Scope::AttributeSpan auxiliary = af.GetAuxiliaryAttributes();
+			Assert::AreEqual<size_t>(2, auxiliary.Size());
+			Assert::IsTrue(auxiliary.begin() == prescribed.end());
+			size_t count = 0;
+			for (const Scope::LookupTableEntry* attribute : auxiliary)
+			{
+				Assert::IsTrue(af.IsAuxiliaryAttribute(attribute->first));
+				++count;
+			}
+			Assert::AreEqual<size_t>(2, count);
+
+			AttributedFoo copy(af);
+			Assert::AreEqual("AuxInt"s, copy.GetAttributes()[copy.PrescribedAttributeCount()]->first);
+			Assert::IsTrue(copy.IsAuxiliaryAttribute("AuxFloat"s));
+			Assert::IsFalse(copy.IsPrescribedAttribute(std::string_view("Missing")));
+
+			copy.Clear();
+			Assert::AreEqual<size_t>(0, copy.GetPrescribedAttributes().Size());
+			Assert::AreEqual<size_t>(0, copy.GetAuxiliaryAttributes().Size());
+		}
+
+		TEST_METHOD(DuplicatePrescribedAttribute)
+		{
+			Vector<Signature> signatures = AttributedFoo::Signatures();
+			signatures.PushBack(PRESCRIBED_ATTRIBUTE(AttributedFoo, "ExternalInteger", external_integer));
+			auto expression = [&] { TypeRegistry::RegisterType(Foo::TypeIdClass(), signatures); };
+			Assert::ExpectException<std::runtime_error>(expression);
+
+			Vector<Signature> named_this;
+			named_this.PushBack(PRESCRIBED_ATTRIBUTE(AttributedFoo, "this", external_integer));
+			auto expression2 = [&] { TypeRegistry::RegisterType(Foo::TypeIdClass(), named_this); };
+			Assert::ExpectException<std::runtime_error>(expression2);
+		}
+
+		TEST_METHOD(PrescribedAttributeLayout)
+		{
+			Signature integer = PRESCRIBED_ATTRIBUTE(AttributedFoo, "ExternalInteger", external_integer);
+			Assert::IsTrue(integer.type == Datum::DatumType::INTEGER);
+			Assert::AreEqual<size_t>(1, integer.size);
+			Assert::AreEqual(offsetof(AttributedFoo, external_integer), integer.offset);
+
+			Signature matrices = PRESCRIBED_ATTRIBUTE(AttributedFoo, "ExternalMatrixArray", external_matrix_array);
+			Assert::IsTrue(matrices.type == Datum::DatumType::MATRIX4X4);
+			Assert::AreEqual<size_t>(10, matrices.size);
+
+			Signature table = MakeTableSignature("NestedScopes", 3);
+			Assert::IsTrue(table.type == Datum::DatumType::TABLE);
+			Assert::AreEqual<size_t>(3, table.size);
+
+			const Vector<InternedString>& names = TypeRegistry::GetPrescribedNames(AttributedFoo::TypeIdClass());
+			Assert::AreEqual<size_t>(13, names.Size());
+			Assert::AreEqual("this"s, names[0].String());
+			Assert::AreEqual("ExternalInteger"s, names[1].String());
+
+			AttributedFoo af;
+			af.external_integer = 7;
+			af.external_string_array[2] = "Hello"s;
+			AttributedFoo copy(af);
+			AttributedFoo moved(std::move(af));
+			for (AttributedFoo* foo : { &copy, &moved })
+			{
+				Scope::AttributeSpan attributes = foo->GetAttributes();
+				for (size_t i = 0; i < names.Size(); ++i)
+				{
+					Assert::AreEqual(names[i].String(), attributes[i]->first);
+				}
+				Assert::IsTrue(&foo->external_integer == &(*foo)["ExternalInteger"].Get<int32_t>());
+				Assert::AreEqual(7, (*foo)["ExternalInteger"].Get<int32_t>());
+				Assert::IsTrue(&foo->external_string_array[2] == &(*foo)["ExternalStringArray"].Get<std::string>(2));
+				Assert::AreEqual("Hello"s, (*foo)["ExternalStringArray"].Get<std::string>(2));
+			}
+		}
+
 	private:
 		static _CrtMemState s_start_mem_state;
 	};
@@ -17,7 +17,7 @@ namespace UnitTests
 	{
 		return Vector<Signature>
 		{
-			{"Health", Datum::DatumType::INTEGER, 1, offsetof(Avatar, Health)}
+			PRESCRIBED_ATTRIBUTE(Avatar, "Health", Health)
 		};
 	}
 }
\ No newline at end of file
@@ -0,0 +1,725 @@
+#include "pch.h"
+#include <chrono>
+#include <sstream>
+#include <set>
+#include <algorithm>
+#include <vector>
+#include <memory>
+#include <cstring>
+#include <cmath>
+#include "DatumMath.h"
+#include "DatumRef.h"
+#include "CppUnitTest.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Library;
+using namespace std::string_literals;
+
+namespace UnitTestLibraryDesktop
+{
+	/// <summary>
+	/// Benchmarks that log their measurements through Logger instead of asserting on timings.
+	/// Assertions only cover properties that do not depend on the machine.
+	/// </summary>
+	TEST_CLASS(BenchmarkTests)
+	{
+	public:
+
+		TEST_CLASS_INITIALIZE(InitializeClass)
+		{
+			TypeRegistry::RegisterType(Entity::TypeIdClass(), Entity::Signatures());
+			TypeRegistry::RegisterType(Sector::TypeIdClass(), Sector::Signatures());
+			TypeRegistry::RegisterType(World::TypeIdClass(), World::Signatures());
+		}
+
+		TEST_CLASS_CLEANUP(CleanupClass)
+		{
+			TypeRegistry::Clear();
+		}
+
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			ObjectPool::Trim();
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+#pragma region HashFunctions
+
+		TEST_METHOD(HashDistribution)
+		{
+			std::stringstream report;
+			HashFunctions<std::string> hash;
+			auto additive = [](const std::string& key) { return AdditiveHash(reinterpret_cast<const uint8_t*>(key.data()), key.size()); };
+
+			//Every key used by the content files and the prescribed attributes of the Attributed classes
+			std::vector<std::string> sceneKeys;
+			for (const std::string& filename : { "Content\\World.json"s, "Content\\ScopeData.json"s, "Content\\TestData.json"s })
+			{
+				std::ifstream file(filename);
+				Json::Value root;
+				file >> root;
+				CollectKeys(root, sceneKeys);
+			}
+			for (const std::string& key : { "this"s, "Name"s, "Sectors"s, "Entities"s, "Actions"s, "Condition"s, "Then"s, "Else"s, "Target"s, "Subtype"s, "Delay"s, "Step"s })
+			{
+				AddUnique(sceneKeys, key);
+			}
+
+			//Large Scope full of auxiliary attributes
+			std::vector<std::string> auxiliaryKeys;
+			for (size_t i = 0; i < 10000; ++i)
+			{
+				auxiliaryKeys.push_back("Attribute"s + std::to_string(i));
+			}
+
+			//Anagrams collide by construction under an additive hash
+			std::vector<std::string> anagramKeys;
+			std::string letters = "Entities";
+			std::sort(letters.begin(), letters.end());
+			do
+			{
+				anagramKeys.push_back(letters);
+			} while (std::next_permutation(letters.begin(), letters.end()));
+
+			for (auto& keySet : { std::make_pair("scene keys", &sceneKeys), std::make_pair("auxiliary keys", &auxiliaryKeys), std::make_pair("anagram keys", &anagramKeys) })
+			{
+				const std::vector<std::string>& keys = *keySet.second;
+				Statistics legacy = Measure(keys, additive);
+				Statistics current = Measure(keys, hash);
+				report << keySet.first << " (" << keys.size() << "): ";
+				report << "additive distinct=" << legacy.Distinct << " max chain=" << legacy.MaxChain << " empty buckets=" << legacy.EmptyBuckets << " " << legacy.Nanoseconds << "ns/key; ";
+				report << "ByteHash distinct=" << current.Distinct << " max chain=" << current.MaxChain << " empty buckets=" << current.EmptyBuckets << " " << current.Nanoseconds << "ns/key\n";
+
+				Assert::AreEqual(keys.size(), current.Distinct);
+				Assert::IsTrue(current.MaxChain <= legacy.MaxChain);
+			}
+			Logger::WriteMessage(report.str().c_str());
+		}
+
+		TEST_METHOD(IntegerHashDistribution)
+		{
+			std::stringstream report;
+			HashFunctions<size_t> hash;
+			auto additive = [](size_t key) { return AdditiveHash(reinterpret_cast<const uint8_t*>(&key), sizeof(key)); };
+
+			//Pointer-like keys: aligned addresses differ only above the low bits
+			std::vector<size_t> keys;
+			for (size_t i = 0; i < 4096; ++i)
+			{
+				keys.push_back(0x10000 + i * 64);
+			}
+
+			Statistics legacy = Measure(keys, additive);
+			Statistics current = Measure(keys, hash);
+			report << "aligned pointers (" << keys.size() << "): additive max chain=" << legacy.MaxChain << " IntegerHash max chain=" << current.MaxChain << " " << current.Nanoseconds << "ns/key\n";
+			Logger::WriteMessage(report.str().c_str());
+
+			Assert::AreEqual(keys.size(), current.Distinct);
+			Assert::IsTrue(current.MaxChain < legacy.MaxChain);
+		}
+
+#pragma endregion
+
+#pragma region GrowthStrategy
+
+		TEST_METHOD(GrowthStrategyWorldLoad)
+		{
+			std::stringstream report;
+			EntityFactory entityFactory;
+			SectorFactory sectorFactory;
+			const std::string json = MakeWorldJson(10, 100, 24);
+
+			const std::pair<const char*, GrowthStrategy> strategies[] =
+			{
+				{ "default", nullptr },
+				{ "golden ratio", &GoldenRatioStrategy::Grow },
+				{ "fixed chunk 8", &FixedChunkStrategy<8>::Grow },
+				{ "exact fit", &ExactFitStrategy::Grow }
+			};
+
+			size_t defaultPeak = 0;
+			for (const auto& [name, strategy] : strategies)
+			{
+				CountingResource counter;
+				{
+					DefaultResourceGuard resourceGuard(counter);
+					std::unique_ptr<GrowthStrategyGuard> strategyGuard = (strategy != nullptr ? std::make_unique<GrowthStrategyGuard>(strategy) : nullptr);
+
+					World world;
+					JsonTableParseHelper::SharedData sharedData(world);
+					JsonTableParseHelper parseHelper;
+					JsonParseMaster parseMaster(sharedData);
+					parseMaster.AddHelper(parseHelper);
+					parseMaster.Initialize();
+
+					auto start = std::chrono::steady_clock::now();
+					parseMaster.Parse(json);
+					auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+					Assert::AreEqual<size_t>(10, world["Sectors"].Size());
+					Assert::AreEqual<size_t>(100, world["Sectors"].Get<Scope>(9)["Entities"].Size());
+					Assert::AreEqual<size_t>(24, world["Sectors"].Get<Scope>(9)["Entities"].Get<Scope>(99)["Scores"].Size());
+					report << name << ": peak=" << counter.PeakBytes << " bytes allocations=" << counter.Allocations << " reallocations=" << counter.Reallocations << " " << elapsed.count() << "us\n";
+				}
+				Assert::AreEqual<size_t>(0, counter.CurrentBytes);
+
+				if (strategy == nullptr)
+				{
+					defaultPeak = counter.PeakBytes;
+				}
+				else if (strategy == &ExactFitStrategy::Grow)
+				{
+					Assert::IsTrue(counter.PeakBytes <= defaultPeak);
+				}
+			}
+			Logger::WriteMessage(report.str().c_str());
+		}
+
+		TEST_METHOD(NumericTextConversion)
+		{
+			const size_t count = 100000;
+			std::vector<std::string> floatTexts;
+			floatTexts.reserve(count);
+			for (size_t i = 0; i < count; ++i)
+			{
+				floatTexts.push_back(std::to_string(static_cast<float>(i) * 0.37f - 1000.0f));
+			}
+
+			std::stringstream report;
+			Datum floats;
+			floats = 0.0f;
+
+			float checksum = 0.0f;
+			auto start = std::chrono::steady_clock::now();
+			for (const std::string& text : floatTexts)
+			{
+				float value;
+				std::stringstream stream(text);
+				stream >> value;
+				checksum += value;
+			}
+			auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+			report << "parse float, stringstream: " << elapsed.count() << "us\n";
+
+			float fastChecksum = 0.0f;
+			start = std::chrono::steady_clock::now();
+			for (const std::string& text : floatTexts)
+			{
+				floats.SetFromString(text);
+				fastChecksum += floats.Get<float_t>();
+			}
+			elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+			report << "parse float, SetFromString: " << elapsed.count() << "us\n";
+			Assert::AreEqual(checksum, fastChecksum);
+
+			const glm::mat4 matrix(glm::vec4(0.1f, 0.2f, 0.3f, 0.4f), glm::vec4(1.0f / 3.0f), glm::vec4(-1.0f), glm::vec4(1e10f, 0.0f, 2.0f, 3.0f));
+			Datum matrices;
+			matrices = matrix;
+			size_t length = 0;
+			start = std::chrono::steady_clock::now();
+			for (size_t i = 0; i < count / 10; ++i)
+			{
+				length += glm::to_string(matrix).size();
+			}
+			elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+			report << "format mat4, glm::to_string: " << elapsed.count() << "us\n";
+
+			start = std::chrono::steady_clock::now();
+			for (size_t i = 0; i < count / 10; ++i)
+			{
+				length += matrices.ToString().size();
+			}
+			elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+			report << "format mat4, ToString: " << elapsed.count() << "us\n";
+			Assert::IsTrue(length > 0);
+
+			//Every formatted float must parse back to the same bits
+			for (uint32_t bits = 0x00800000; bits < 0x7F800000; bits += 0x000F4243)
+			{
+				float value;
+				std::memcpy(&value, &bits, sizeof(value));
+				floats.Set(-value);
+				std::string text = floats.ToString();
+				floats.Set(0.0f);
+				floats.SetFromString(text);
+				Assert::AreEqual(-value, floats.Get<float_t>());
+			}
+
+			Logger::WriteMessage(report.str().c_str());
+		}
+
+#pragma endregion
+
+#pragma region DatumMath
+
+		TEST_METHOD(DatumMathKernels)
+		{
+			const size_t particleCount = 100000;
+			const size_t matrixCount = 10000;
+			const float deltaTime = 0.016f;
+			const glm::mat4 transform(glm::vec4(0.0f, 1.0f, 0.0f, 0.0f), glm::vec4(-1.0f, 0.0f, 0.0f, 0.0f), glm::vec4(0.0f, 0.0f, 1.0f, 0.0f), glm::vec4(5.0f, -2.0f, 0.5f, 1.0f));
+
+			Datum positions;
+			Datum velocities;
+			Datum matrices;
+			positions.SetType(Datum::DatumType::VECTOR4);
+			velocities.SetType(Datum::DatumType::VECTOR4);
+			positions.Reserve(particleCount);
+			velocities.Reserve(particleCount);
+			for (size_t i = 0; i < particleCount; ++i)
+			{
+				const float f = static_cast<float>(i % 1000);
+				positions.PushBack(glm::vec4(f, -f, f * 0.5f, 1.0f));
+				velocities.PushBack(glm::vec4(1.0f, f * 0.01f, -2.0f, 0.0f));
+			}
+			for (size_t i = 0; i < matrixCount; ++i)
+			{
+				matrices.PushBack(glm::mat4(static_cast<float>(i % 7 + 1)));
+			}
+
+			std::stringstream report;
+
+			//Element by element through Get, the way gameplay code updated Datums before
+			{
+				Datum moved(positions);
+				const Datum& constVelocities = velocities;
+				auto start = std::chrono::steady_clock::now();
+				for (size_t i = 0; i < particleCount; ++i)
+				{
+					glm::vec4& position = moved.Get<glm::vec4>(i);
+					const glm::vec4& velocity = constVelocities.Get<glm::vec4>(i);
+					for (int component = 0; component < 4; ++component)
+					{
+						position[component] += velocity[component] * deltaTime;
+					}
+				}
+				auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+				report << "Get<vec4> loop: multiply-add=" << elapsed.count() << "us\n";
+			}
+
+			glm::vec4 scalarPosition;
+			glm::mat4 scalarMatrix;
+			for (int i = 0; i <= static_cast<int>(DatumMath::Supported()); ++i)
+			{
+				const DatumMath::InstructionSet instructionSet = static_cast<DatumMath::InstructionSet>(i);
+				DatumMath::SetActive(instructionSet);
+				Datum moved(positions);
+				Datum multiplied(matrices);
+
+				auto start = std::chrono::steady_clock::now();
+				DatumMath::MultiplyAdd(moved, velocities, deltaTime);
+				auto multiplyAdd = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+				start = std::chrono::steady_clock::now();
+				DatumMath::Transform(moved, transform);
+				auto transformed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+				start = std::chrono::steady_clock::now();
+				DatumMath::Multiply(multiplied, transform);
+				auto multiply = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+				start = std::chrono::steady_clock::now();
+				const float sum = DatumMath::Sum(moved);
+				const float min = DatumMath::Min(moved);
+				const float max = DatumMath::Max(moved);
+				auto reductions = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+				report << DatumMath::Name(instructionSet) << ": multiply-add=" << multiplyAdd.count() << "us transform=" << transformed.count()
+					<< "us matrix multiply=" << multiply.count() << "us sum+min+max=" << reductions.count() << "us\n";
+
+				//Kernels round and sum in different orders, so compare with a double precision reference instead of exactly
+				const Datum& constMoved = moved;
+				double referenceSum = 0.0;
+				double magnitude = 0.0;
+				for (const glm::vec4& position : constMoved.AsSpan<glm::vec4>())
+				{
+					for (int component = 0; component < 4; ++component)
+					{
+						referenceSum += position[component];
+						magnitude += std::abs(position[component]);
+					}
+				}
+				Assert::IsTrue(std::abs(sum - referenceSum) <= magnitude * 1e-3);
+				Assert::IsTrue(min <= max);
+
+				if (instructionSet == DatumMath::InstructionSet::Scalar)
+				{
+					scalarPosition = constMoved.AsSpan<glm::vec4>()[particleCount - 1];
+					scalarMatrix = multiplied.Get<glm::mat4>(matrixCount - 1);
+				}
+				const glm::vec4& position = constMoved.AsSpan<glm::vec4>()[particleCount - 1];
+				const glm::mat4& matrix = static_cast<const Datum&>(multiplied).Get<glm::mat4>(matrixCount - 1);
+				for (int component = 0; component < 4; ++component)
+				{
+					Assert::AreEqual(scalarPosition[component], position[component], 1e-3f);
+					Assert::IsTrue(scalarMatrix[component] == matrix[component]);
+				}
+			}
+			DatumMath::SetActive(DatumMath::Supported());
+			Logger::WriteMessage(report.str().c_str());
+		}
+
+		TEST_METHOD(DatumSearch)
+		{
+			std::stringstream report;
+			UnitTests::Foo foo;
+			UnitTests::Foo target;
+			const size_t sizes[] = { 1000, 100000, 1000000 };
+			for (size_t size : sizes)
+			{
+				//The item sits at the end, so every Find scans the whole Datum
+				Datum integers;
+				Datum floats;
+				Datum pointers;
+				integers.SetType(Datum::DatumType::INTEGER);
+				floats.SetType(Datum::DatumType::FLOAT);
+				pointers.SetType(Datum::DatumType::POINTER);
+				integers.Reserve(size);
+				floats.Reserve(size);
+				pointers.Reserve(size);
+				for (size_t i = 0; i < size; ++i)
+				{
+					integers.PushBack(static_cast<int32_t>(i));
+					floats.PushBack(static_cast<float_t>(i));
+					pointers.PushBack(i + 1 < size ? &foo : &target);
+				}
+				const Datum otherPointers(pointers);
+				const size_t repetitions = std::max<size_t>(1, 10000000 / size);
+
+				for (int i = 0; i <= static_cast<int>(DatumMath::Supported()); ++i)
+				{
+					const DatumMath::InstructionSet instructionSet = static_cast<DatumMath::InstructionSet>(i);
+					DatumMath::SetActive(instructionSet);
+					size_t found = 0;
+
+					auto start = std::chrono::steady_clock::now();
+					for (size_t repetition = 0; repetition < repetitions; ++repetition)
+					{
+						found += integers.Find(static_cast<int32_t>(size - 1));
+					}
+					auto findIntegers = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+					start = std::chrono::steady_clock::now();
+					for (size_t repetition = 0; repetition < repetitions; ++repetition)
+					{
+						found += floats.Find(static_cast<float_t>(size - 1));
+					}
+					auto findFloats = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+					start = std::chrono::steady_clock::now();
+					for (size_t repetition = 0; repetition < repetitions; ++repetition)
+					{
+						found += pointers.Find(target);
+					}
+					auto findPointers = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+					size_t equal = 0;
+					start = std::chrono::steady_clock::now();
+					for (size_t repetition = 0; repetition < repetitions; ++repetition)
+					{
+						equal += (otherPointers == pointers ? 1 : 0);
+					}
+					auto compare = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+					Assert::AreEqual(3 * repetitions * (size - 1), found);
+					Assert::AreEqual(repetitions, equal);
+					report << size << " elements x" << repetitions << ", " << DatumMath::Name(instructionSet) << ": find int=" << findIntegers.count()
+						<< "us find float=" << findFloats.count() << "us find pointer=" << findPointers.count() << "us compare pointers=" << compare.count() << "us\n";
+				}
+			}
+			DatumMath::SetActive(DatumMath::Supported());
+			Logger::WriteMessage(report.str().c_str());
+		}
+
+#pragma endregion
+
+#pragma region DatumRef
+
+		TEST_METHOD(TypedDatumAccess)
+		{
+			//An attribute of a scope, as an Action would see it, so every write also marks the structural hash stale
+			const size_t size = 1000000;
+			Scope scope;
+			Datum& checked = scope["Checked"];
+			Datum& typed = scope["Typed"];
+			DatumRef<int32_t> typedRef(typed);
+
+			auto start = std::chrono::steady_clock::now();
+			for (size_t i = 0; i < size; ++i)
+			{
+				checked.PushBack(static_cast<int32_t>(i));
+			}
+			auto pushChecked = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+			start = std::chrono::steady_clock::now();
+			for (size_t i = 0; i < size; ++i)
+			{
+				typedRef.PushBack(static_cast<int32_t>(i));
+			}
+			auto pushTyped = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+			const Datum& constChecked = checked;
+			int64_t checkedSum = 0;
+			start = std::chrono::steady_clock::now();
+			for (size_t i = 0; i < constChecked.Size(); ++i)
+			{
+				checkedSum += constChecked.Get<int32_t>(i);
+			}
+			auto readChecked = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+			int64_t typedSum = 0;
+			start = std::chrono::steady_clock::now();
+			for (size_t i = 0; i < typedRef.Size(); ++i)
+			{
+				typedSum += typedRef.Get(i);
+			}
+			auto readTyped = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+			start = std::chrono::steady_clock::now();
+			for (size_t i = 0; i < checked.Size(); ++i)
+			{
+				++checked.Get<int32_t>(i);
+			}
+			auto writeChecked = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+			start = std::chrono::steady_clock::now();
+			for (int32_t& value : typedRef)
+			{
+				++value;
+			}
+			auto writeTyped = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+			Assert::AreEqual(checkedSum, typedSum);
+			Assert::IsTrue(checked == typed);
+
+			std::stringstream report;
+			report << size << " integers, Datum / DatumRef: push=" << pushChecked.count() << "us / " << pushTyped.count() << "us read="
+				<< readChecked.count() << "us / " << readTyped.count() << "us write=" << writeChecked.count() << "us / " << writeTyped.count() << "us\n";
+			Logger::WriteMessage(report.str().c_str());
+		}
+
+#pragma endregion
+
+#pragma region StructuralHash
+
+		TEST_METHOD(VolatileTreeComparison)
+		{
+			//Every scope holds an external attribute, as every Attributed does, so none of them can cache its hash
+			std::vector<float_t> positions(4, 1.0f);
+			const size_t fanOut = 6;
+			const size_t depth = 4;
+			auto build = [&positions, fanOut](Scope& scope, size_t levels, auto& recurse) -> void
+			{
+				scope["Position"].SetStorage(positions.data(), positions.size());
+				Datum& scores = scope["Scores"];
+				for (int32_t score = 0; score < 24; ++score)
+				{
+					scores.PushBack(score);
+				}
+				if (levels > 0)
+				{
+					for (size_t child = 0; child < fanOut; ++child)
+					{
+						recurse(scope.AppendScope("Children"), levels - 1, recurse);
+					}
+				}
+			};
+			Scope left;
+			Scope right;
+			build(left, depth, build);
+			build(right, depth, build);
+			const size_t repetitions = 20;
+
+			size_t equal = 0;
+			auto start = std::chrono::steady_clock::now();
+			for (size_t repetition = 0; repetition < repetitions; ++repetition)
+			{
+				equal += (left == right ? 1 : 0);
+			}
+			auto unchanged = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+			//The same write on both sides keeps the trees equal but leaves every ancestor's cached hash stale
+			Datum& leftScores = left["Children"][5]["Children"][5]["Children"][5]["Children"][5]["Scores"];
+			Datum& rightScores = right["Children"][5]["Children"][5]["Children"][5]["Children"][5]["Scores"];
+			start = std::chrono::steady_clock::now();
+			for (size_t repetition = 0; repetition < repetitions; ++repetition)
+			{
+				leftScores.Set(static_cast<int32_t>(repetition), 23);
+				rightScores.Set(static_cast<int32_t>(repetition), 23);
+				equal += (left == right ? 1 : 0);
+			}
+			auto written = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+			Assert::AreEqual(2 * repetitions, equal);
+			std::stringstream report;
+			report << "1555 scopes x" << repetitions << ": compare unchanged=" << unchanged.count() << "us compare after a write=" << written.count() << "us\n";
+			Logger::WriteMessage(report.str().c_str());
+		}
+
+#pragma endregion
+
+	private:
+		/// <summary>
+		/// Forwards to the heap and records the container memory a workload requests
+		/// </summary>
+		class CountingResource final : public MemoryResource
+		{
+		public:
+			void* Allocate(size_t bytes) override
+			{
+				++Allocations;
+				Track(bytes, 0);
+				return MemoryResource::Heap().Allocate(bytes);
+			}
+
+			void Deallocate(void* pointer, size_t bytes) override
+			{
+				if (pointer != nullptr)
+				{
+					CurrentBytes -= bytes;
+					MemoryResource::Heap().Deallocate(pointer, bytes);
+				}
+			}
+
+			void* Reallocate(void* pointer, size_t oldBytes, size_t newBytes) override
+			{
+				if (pointer == nullptr)
+				{
+					return Allocate(newBytes);
+				}
+				++Reallocations;
+				Track(newBytes, oldBytes);
+				return MemoryResource::Heap().Reallocate(pointer, oldBytes, newBytes);
+			}
+
+			size_t Allocations = 0;
+			size_t Reallocations = 0;
+			size_t CurrentBytes = 0;
+			size_t PeakBytes = 0;
+
+		private:
+			void Track(size_t newBytes, size_t oldBytes)
+			{
+				CurrentBytes += newBytes - oldBytes;
+				PeakBytes = std::max(PeakBytes, CurrentBytes);
+			}
+		};
+
+		/// <summary>
+		/// Builds a World in the format of Content\World.json with the given number of sectors and entities per sector,
+		/// every entity carrying an integer array of the given length
+		/// </summary>
+		static std::string MakeWorldJson(size_t sectorCount, size_t entityCount, size_t scoreCount)
+		{
+			std::stringstream json;
+			json << R"json({"Name":{"Type":"string","Value":"World"},"Sectors":{"Type":"table","Value":[)json";
+			for (size_t sector = 0; sector < sectorCount; ++sector)
+			{
+				json << (sector > 0 ? "," : "") << R"json({"Class":"Sector","Type":"table","Value":{"Name":{"Type":"string","Value":"Sector)json" << sector << R"json("},"Entities":{"Type":"table","Value":[)json";
+				for (size_t entity = 0; entity < entityCount; ++entity)
+				{
+					json << (entity > 0 ? "," : "") << R"json({"Class":"Entity","Type":"table","Value":{"Name":{"Type":"string","Value":"Entity)json" << entity << R"json("},"Position":{"Type":"vector4","Value":"vec4(1.0, 2.0, 3.0, 4.0)"},"Scores":{"Type":"integer","Value":[)json";
+					for (size_t score = 0; score < scoreCount; ++score)
+					{
+						json << (score > 0 ? "," : "") << score;
+					}
+					json << "]}}}";
+				}
+				json << "]}}}";
+			}
+			json << "]}}";
+			return json.str();
+		}
+
+		struct Statistics
+		{
+			size_t Distinct = 0;
+			size_t MaxChain = 0;
+			size_t EmptyBuckets = 0;
+			double Nanoseconds = 0.0;
+		};
+
+		template <typename TKey, typename THash>
+		static Statistics Measure(const std::vector<TKey>& keys, const THash& hash)
+		{
+			//Power-of-two bucket count at load factor 1, so poorly mixed low bits show up as long chains
+			size_t bucketCount = 1;
+			while (bucketCount < keys.size())
+			{
+				bucketCount <<= 1;
+			}
+
+			Statistics statistics;
+			std::vector<size_t> chains(bucketCount);
+			std::set<size_t> hashes;
+			for (const TKey& key : keys)
+			{
+				size_t value = hash(key);
+				hashes.insert(value);
+				statistics.MaxChain = std::max(statistics.MaxChain, ++chains[value & (bucketCount - 1)]);
+			}
+			statistics.Distinct = hashes.size();
+			statistics.EmptyBuckets = static_cast<size_t>(std::count(chains.begin(), chains.end(), size_t(0)));
+
+			const size_t rounds = 20;
+			volatile size_t sink = 0;
+			auto start = std::chrono::high_resolution_clock::now();
+			for (size_t round = 0; round < rounds; ++round)
+			{
+				for (const TKey& key : keys)
+				{
+					sink += hash(key);
+				}
+			}
+			auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start);
+			statistics.Nanoseconds = static_cast<double>(elapsed.count()) / (rounds * keys.size());
+			return statistics;
+		}
+
+		static void AddUnique(std::vector<std::string>& keys, const std::string& key)
+		{
+			if (std::find(keys.begin(), keys.end(), key) == keys.end())
+			{
+				keys.push_back(key);
+			}
+		}
+
+		static void CollectKeys(const Json::Value& value, std::vector<std::string>& keys)
+		{
+			if (value.isObject())
+			{
+				for (const std::string& name : value.getMemberNames())
+				{
+					AddUnique(keys, name);
+					CollectKeys(value[name], keys);
+				}
+			}
+			else if (value.isArray())
+			{
+				for (const Json::Value& element : value)
+				{
+					CollectKeys(element, keys);
+				}
+			}
+		}
+
+		static _CrtMemState sStartMemState;
+	};
+	_CrtMemState BenchmarkTests::sStartMemState;
+}
@@ -0,0 +1,285 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "DatumMath.h"
+#include <vector>
+#include <limits>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Library;
+using namespace std::string_literals;
+
+namespace UnitTestLibraryDesktop
+{
+	/// <summary>
+	/// Every test runs once per instruction set the machine supports. Values are small integers, so every kernel computes
+	/// them exactly and results can be compared with ==. Element counts are odd so the scalar tails run too.
+	/// </summary>
+	TEST_CLASS(DatumMathTests)
+	{
+	public:
+
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			DatumMath::SetActive(DatumMath::Supported());
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(InstructionSets)
+		{
+			Assert::IsTrue(DatumMath::Active() == DatumMath::Supported());
+			DatumMath::SetActive(DatumMath::InstructionSet::Scalar);
+			Assert::IsTrue(DatumMath::Active() == DatumMath::InstructionSet::Scalar);
+			Assert::AreEqual("Scalar"s, std::string(DatumMath::Name(DatumMath::Active())));
+
+			if (DatumMath::Supported() != DatumMath::InstructionSet::AVX2)
+			{
+				auto expression = [] { DatumMath::SetActive(DatumMath::InstructionSet::AVX2); };
+				Assert::ExpectException<std::runtime_error>(expression);
+			}
+		}
+
+		TEST_METHOD(ElementWise)
+		{
+			for (DatumMath::InstructionSet instructionSet : SupportedInstructionSets())
+			{
+				DatumMath::SetActive(instructionSet);
+
+				Datum floats;
+				Datum otherFloats;
+				for (int i = 0; i < 21; ++i)
+				{
+					floats.PushBack(static_cast<float_t>(i));
+					otherFloats.PushBack(static_cast<float_t>(2 * i));
+				}
+				DatumMath::Add(floats, otherFloats);
+				Assert::AreEqual(60.0f, floats.Get<float_t>(20));
+				DatumMath::Scale(floats, 0.5f);
+				Assert::AreEqual(30.0f, floats.Get<float_t>(20));
+				DatumMath::MultiplyAdd(floats, otherFloats, -2.0f);
+				Assert::AreEqual(-50.0f, floats.Get<float_t>(20));
+				Assert::AreEqual(-2.5f, floats.Get<float_t>(1));
+
+				Datum positions;
+				Datum velocities;
+				for (int i = 0; i < 7; ++i)
+				{
+					positions.PushBack(glm::vec4(static_cast<float>(i), 0.0f, 1.0f, 1.0f));
+					velocities.PushBack(glm::vec4(1.0f, 2.0f, static_cast<float>(i), 0.0f));
+				}
+				DatumMath::MultiplyAdd(positions, velocities, 0.5f);
+				Assert::IsTrue(glm::vec4(6.5f, 1.0f, 4.0f, 1.0f) == positions.Get<glm::vec4>(6));
+
+				//Adding a Datum to itself
+				DatumMath::Add(positions, positions);
+				Assert::IsTrue(glm::vec4(13.0f, 2.0f, 8.0f, 2.0f) == positions.Get<glm::vec4>(6));
+
+				Datum empty;
+				empty.SetType(Datum::DatumType::MATRIX4X4);
+				DatumMath::Scale(empty, 2.0f);
+				Assert::AreEqual(0.0f, DatumMath::Sum(empty));
+			}
+		}
+
+		TEST_METHOD(Transforms)
+		{
+			const glm::mat4 matrix(glm::vec4(1.0f, 2.0f, 3.0f, 4.0f), glm::vec4(-1.0f, 0.0f, 2.0f, 1.0f), glm::vec4(0.0f, 5.0f, 1.0f, -2.0f), glm::vec4(3.0f, 1.0f, 0.0f, 1.0f));
+			for (DatumMath::InstructionSet instructionSet : SupportedInstructionSets())
+			{
+				DatumMath::SetActive(instructionSet);
+
+				Datum vectors;
+				std::vector<glm::vec4> expected;
+				for (int i = 0; i < 5; ++i)
+				{
+					glm::vec4 vector(static_cast<float>(i), static_cast<float>(1 - i), 2.0f, static_cast<float>(i % 2));
+					vectors.PushBack(vector);
+					expected.push_back(matrix * vector);
+				}
+				DatumMath::Transform(vectors, matrix);
+				for (size_t i = 0; i < expected.size(); ++i)
+				{
+					Assert::IsTrue(expected[i] == vectors.Get<glm::vec4>(i));
+				}
+
+				Datum matrices;
+				std::vector<glm::mat4> expectedMatrices;
+				for (int i = 0; i < 3; ++i)
+				{
+					glm::mat4 other(static_cast<float>(i + 1));
+					other[3] = glm::vec4(static_cast<float>(i), 1.0f, -1.0f, 1.0f);
+					matrices.PushBack(other);
+					expectedMatrices.push_back(matrix * other);
+				}
+				DatumMath::Multiply(matrices, matrix);
+				for (size_t i = 0; i < expectedMatrices.size(); ++i)
+				{
+					Assert::IsTrue(expectedMatrices[i] == matrices.Get<glm::mat4>(i));
+				}
+
+				auto expression = [&] { DatumMath::Transform(matrices, matrix); };
+				Assert::ExpectException<std::runtime_error>(expression);
+				auto expression2 = [&] { DatumMath::Multiply(vectors, matrix); };
+				Assert::ExpectException<std::runtime_error>(expression2);
+			}
+		}
+
+		TEST_METHOD(Reductions)
+		{
+			for (DatumMath::InstructionSet instructionSet : SupportedInstructionSets())
+			{
+				DatumMath::SetActive(instructionSet);
+
+				Datum floats;
+				for (int i = 0; i < 19; ++i)
+				{
+					floats.PushBack(static_cast<float_t>((i * 7) % 19 - 9));
+				}
+				Assert::AreEqual(0.0f, DatumMath::Sum(floats));
+				Assert::AreEqual(-9.0f, DatumMath::Min(floats));
+				Assert::AreEqual(9.0f, DatumMath::Max(floats));
+
+				Datum vectors;
+				for (int i = 0; i < 3; ++i)
+				{
+					vectors.PushBack(glm::vec4(static_cast<float>(i), -1.0f, 2.0f, static_cast<float>(-i)));
+				}
+				vectors.Set(glm::vec4(0.0f, -1.0f, 2.0f, 11.0f), 1);
+				Assert::AreEqual(14.0f, DatumMath::Sum(vectors));
+				Assert::AreEqual(-2.0f, DatumMath::Min(vectors));
+				Assert::AreEqual(11.0f, DatumMath::Max(vectors));
+
+				Datum matrices;
+				matrices.PushBack(glm::mat4(2.0f));
+				Assert::AreEqual(8.0f, DatumMath::Sum(matrices));
+				Assert::AreEqual(0.0f, DatumMath::Min(matrices));
+				Assert::AreEqual(2.0f, DatumMath::Max(matrices));
+			}
+		}
+
+		TEST_METHOD(Search)
+		{
+			std::vector<std::int32_t> integers;
+			std::vector<float> floats;
+			std::vector<const void*> pointers;
+			for (int i = 0; i < 37; ++i)
+			{
+				integers.push_back(i * 3);
+				floats.push_back(static_cast<float>(i) - 0.5f);
+				pointers.push_back(&integers);
+			}
+			for (size_t i = 0; i < pointers.size(); ++i)
+			{
+				pointers[i] = &floats[i];
+			}
+			floats[20] = -0.0f;
+			floats[21] = std::numeric_limits<float>::quiet_NaN();
+
+			for (DatumMath::InstructionSet instructionSet : SupportedInstructionSets())
+			{
+				DatumMath::SetActive(instructionSet);
+				for (size_t i = 0; i < integers.size(); ++i)
+				{
+					Assert::AreEqual(i, DatumMath::Find(integers.data(), integers.size(), integers[i]));
+					Assert::AreEqual(i, DatumMath::Find(pointers.data(), pointers.size(), pointers[i]));
+					//Every search starts mid-array too, so each kernel sees every alignment and tail length
+					Assert::AreEqual(integers.size() - i, DatumMath::Find(integers.data() + i, integers.size() - i, -1));
+				}
+				Assert::AreEqual<size_t>(5, DatumMath::Find(floats.data(), floats.size(), 4.5f));
+				Assert::AreEqual<size_t>(20, DatumMath::Find(floats.data(), floats.size(), 0.0f));
+				Assert::AreEqual(floats.size(), DatumMath::Find(floats.data(), floats.size(), std::numeric_limits<float>::quiet_NaN()));
+				Assert::AreEqual(floats.size(), DatumMath::Find(floats.data(), floats.size(), 100.0f));
+				Assert::AreEqual(pointers.size(), DatumMath::Find(pointers.data(), pointers.size(), &pointers));
+
+				std::vector<const void*> copy(pointers);
+				Assert::AreEqual(pointers.size(), DatumMath::Mismatch(pointers.data(), copy.data(), pointers.size()));
+				for (size_t i = 0; i < copy.size(); ++i)
+				{
+					copy[i] = nullptr;
+					Assert::AreEqual(i, DatumMath::Mismatch(pointers.data(), copy.data(), pointers.size()));
+					copy[i] = pointers[i];
+				}
+				Assert::AreEqual<size_t>(0, DatumMath::Find(integers.data(), 0, 0));
+			}
+		}
+
+		TEST_METHOD(Errors)
+		{
+			Datum integers;
+			integers.PushBack(1);
+			auto expression = [&] { DatumMath::Scale(integers, 2.0f); };
+			Assert::ExpectException<std::runtime_error>(expression);
+			auto expression2 = [&] { DatumMath::Sum(integers); };
+			Assert::ExpectException<std::runtime_error>(expression2);
+
+			Datum floats;
+			floats.PushBack(1.0f);
+			Datum moreFloats;
+			moreFloats.PushBack(1.0f);
+			moreFloats.PushBack(2.0f);
+			auto expression3 = [&] { DatumMath::Add(floats, moreFloats); };
+			Assert::ExpectException<std::runtime_error>(expression3);
+			Datum vectors;
+			vectors.PushBack(glm::vec4(1.0f));
+			auto expression4 = [&] { DatumMath::MultiplyAdd(floats, vectors, 1.0f); };
+			Assert::ExpectException<std::runtime_error>(expression4);
+
+			Datum empty;
+			empty.SetType(Datum::DatumType::FLOAT);
+			auto expression5 = [&] { DatumMath::Min(empty); };
+			Assert::ExpectException<std::runtime_error>(expression5);
+			auto expression6 = [&] { DatumMath::Max(empty); };
+			Assert::ExpectException<std::runtime_error>(expression6);
+		}
+
+		TEST_METHOD(CopyOnWrite)
+		{
+			Datum floats;
+			for (int i = 0; i < 9; ++i)
+			{
+				floats.PushBack(static_cast<float_t>(i));
+			}
+			Datum copy;
+			{
+				CopyOnWriteGuard guard;
+				copy = floats;
+			}
+			Assert::IsTrue(copy.IsShared());
+			DatumMath::Scale(copy, 2.0f);
+			Assert::AreEqual(8.0f, floats.Get<float_t>(8));
+			Assert::AreEqual(16.0f, copy.Get<float_t>(8));
+		}
+
+	private:
+		/// <summary>
+		/// Provides every instruction set the machine supports
+		/// </summary>
+		static std::vector<DatumMath::InstructionSet> SupportedInstructionSets()
+		{
+			std::vector<DatumMath::InstructionSet> instructionSets;
+			for (int i = 0; i <= static_cast<int>(DatumMath::Supported()); ++i)
+			{
+				instructionSets.push_back(static_cast<DatumMath::InstructionSet>(i));
+			}
+			return instructionSets;
+		}
+
+		static _CrtMemState sStartMemState;
+	};
+	_CrtMemState DatumMathTests::sStartMemState;
+}
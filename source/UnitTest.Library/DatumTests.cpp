@@ -1,10 +1,12 @@
 #include "pch.h"
 #include "CppUnitTest.h"
+#include "DatumRef.h"
 #include <string>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace Library;
 using namespace UnitTests;
+using namespace std::string_literals;
 
 namespace Microsoft::VisualStudio::CppUnitTestFramework
 {
@@ -41,6 +43,7 @@ namespace UnitTestLibraryDesktop
 
 		TEST_METHOD_CLEANUP(Cleanup)
 		{
+			ObjectPool::Trim();
 #if defined(DEBUG) || defined(_DEBUG)
 			_CrtMemState endMemState, diffMemState;
 			_CrtMemCheckpoint(&endMemState);
@@ -124,6 +127,67 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual<size_t>(0, d.Capacity());
 			Assert::AreEqual(Datum::DatumType::UNKNOWN, d.Type());
 		}
+
+		TEST_METHOD(InlineStorage)
+		{
+			Datum integers;
+			integers.PushBack(1);
+			Assert::IsTrue(integers.IsInline());
+			integers.PushBack(2);
+			integers.PushBack(3);
+			Assert::IsTrue(integers.IsInline());
+			Assert::AreEqual<size_t>(3, integers.Capacity());
+			integers.PushBack(4);
+			Assert::IsFalse(integers.IsInline());
+			for (int32_t i = 0; i < 4; ++i)
+			{
+				Assert::AreEqual(i + 1, integers.Get<int32_t>(i));
+			}
+
+			Datum vector;
+			vector.PushBack(glm::vec4(1.0f, 2.0f, 3.0f, 4.0f));
+			Assert::IsTrue(vector.IsInline());
+			vector.PushBack(glm::vec4(5.0f));
+			Assert::IsFalse(vector.IsInline());
+			Assert::IsTrue(glm::vec4(1.0f, 2.0f, 3.0f, 4.0f) == vector.Get<glm::vec4>(0));
+			Assert::IsTrue(glm::vec4(5.0f) == vector.Get<glm::vec4>(1));
+
+			Datum strings;
+			strings.PushBack(std::string("Name"));
+			Assert::IsFalse(strings.IsInline());
+
+			Datum matrix;
+			matrix.PushBack(glm::mat4x4(1.0f));
+			Assert::IsFalse(matrix.IsInline());
+
+			Datum moved = std::move(vector);
+			Assert::IsFalse(moved.IsInline());
+			Datum pointer;
+			Foo foo(5);
+			pointer.PushBack(&foo);
+			Assert::IsTrue(pointer.IsInline());
+
+			Datum movedPointer = std::move(pointer);
+			Assert::IsTrue(movedPointer.IsInline());
+			Assert::IsFalse(pointer.IsInline());
+			Assert::IsTrue(movedPointer.Get<RTTI*>() == &foo);
+
+			Datum copy(movedPointer);
+			Assert::IsTrue(copy.IsInline());
+			Assert::IsTrue(copy.Get<RTTI*>() == &foo);
+
+			Datum assigned;
+			assigned.PushBack(glm::vec4(1.0f));
+			assigned = std::move(movedPointer);
+			Assert::IsTrue(assigned.IsInline());
+			Assert::IsTrue(assigned.Get<RTTI*>() == &foo);
+
+			integers.Clear();
+			Assert::IsFalse(integers.IsInline());
+			integers.PushBack(7);
+			Assert::IsTrue(integers.IsInline());
+			Assert::AreEqual(7, integers.Front<int32_t>());
+		}
 #pragma endregion
 
 		TEST_METHOD(Assignment)
@@ -489,6 +553,10 @@ namespace UnitTestLibraryDesktop
 			Datum typeless;
 			auto expression = [&] {typeless.Resize(3); };
 			Assert::ExpectException<std::exception>(expression);
+			typeless.Reserve(3);
+			Assert::AreEqual<size_t>(0, typeless.Capacity());
+			typeless.PushBack(glm::vec4(1.0f));
+			Assert::IsTrue(glm::vec4(1.0f) == typeless.Get<glm::vec4>());
 			
 
 			Datum integers;
@@ -765,6 +833,401 @@ namespace UnitTestLibraryDesktop
 			Assert::IsTrue("10" == integers.ToString());
 		}
 
+		TEST_METHOD(NumericTextRoundTrip)
+		{
+			Datum floats;
+			floats = 0.0f;
+			const float floatValues[] = { 0.1f, 1e-38f, -3.4028235e38f, 100.1f, 1.0f / 3.0f, 0.0f };
+			for (float value : floatValues)
+			{
+				floats.Set(value);
+				std::string text = floats.ToString();
+				floats.Set(0.5f);
+				floats.SetFromString(text);
+				Assert::AreEqual(value, floats.Get<float_t>());
+			}
+			floats.Set(1.5f);
+			Assert::IsTrue("1.5" == floats.ToString());
+
+			Datum integers;
+			integers = -2147483647 - 1;
+			Assert::IsTrue("-2147483648" == integers.ToString());
+			integers.SetFromString(" +42");
+			Assert::AreEqual(42, integers.Get<int32_t>());
+
+			Datum vectors;
+			vectors = glm::vec4(0.1f, -2.5f, 1e-38f, 7.0f);
+			Assert::IsTrue("vec4(0.1, -2.5, 1e-38, 7)" == vectors.ToString());
+			glm::vec4 vector = vectors.Get<glm::vec4>();
+			vectors.Set(glm::vec4(0.0f));
+			vectors.SetFromString("vec4(0.1, -2.5, 1e-38, 7)");
+			Assert::IsTrue(vector == vectors.Get<glm::vec4>());
+
+			Datum matrices;
+			glm::mat4 matrix(glm::vec4(0.1f, 0.2f, 0.3f, 0.4f), glm::vec4(1.0f / 3.0f), glm::vec4(-1.0f), glm::vec4(1e10f, 0.0f, 2.0f, 3.0f));
+			matrices = matrix;
+			std::string text = matrices.ToString();
+			Assert::IsTrue(text.rfind("mat4x4((0.1, 0.2, 0.3, 0.4), ", 0) == 0);
+			matrices.Set(glm::mat4(0.0f));
+			matrices.SetFromString(text);
+			Assert::IsTrue(matrix == matrices.Get<glm::mat4>());
+
+			auto expression = [&] { integers.SetFromString("forty two"); };
+			Assert::ExpectException<std::runtime_error>(expression);
+			auto expression2 = [&] { vectors.SetFromString("vec4(1, 2, 3)"); };
+			Assert::ExpectException<std::runtime_error>(expression2);
+			auto expression3 = [&] { matrices.SetFromString("mat4x4((1, 2, 3, 4))"); };
+			Assert::ExpectException<std::runtime_error>(expression3);
+		}
+
+		TEST_METHOD(SearchAndCompare)
+		{
+			Foo foos[40];
+			Datum pointers;
+			Datum integers;
+			for (int i = 0; i < 40; ++i)
+			{
+				pointers.PushBack(&foos[i]);
+				integers.PushBack(i);
+			}
+			Assert::AreEqual<size_t>(33, pointers.Find(foos[33]));
+			Assert::IsTrue(pointers.Remove(foos[33]));
+			Assert::AreEqual<size_t>(39, pointers.Size());
+			Assert::IsTrue(&foos[34] == pointers.Get<RTTI*>(33));
+			Assert::AreEqual<size_t>(39, pointers.Find(foos[33]));
+			Assert::IsTrue(integers.Remove(0));
+			Assert::AreEqual(39, integers.Get<int32_t>(38));
+			Assert::AreEqual<size_t>(38, integers.Find(39));
+
+			//Different pointers still compare equal when the objects do
+			Scope scopes[40];
+			Scope copies[40];
+			Datum scopePointers;
+			Datum otherScopePointers;
+			for (int i = 0; i < 40; ++i)
+			{
+				scopePointers.PushBack(&scopes[i]);
+				otherScopePointers.PushBack((i % 2 == 0) ? &scopes[i] : &copies[i]);
+			}
+			Assert::IsTrue(otherScopePointers == scopePointers);
+			copies[37].Append("Health") = 10;
+			Assert::IsTrue(otherScopePointers != scopePointers);
+
+			//A null pointer equals only another null, whichever side it is on
+			Datum nullPointers;
+			nullPointers.PushBack(static_cast<RTTI*>(nullptr));
+			Datum fooPointers;
+			fooPointers.PushBack(&foos[0]);
+			Assert::IsFalse(nullPointers == fooPointers);
+			Assert::IsFalse(fooPointers == nullPointers);
+			Datum otherNullPointers;
+			otherNullPointers.PushBack(static_cast<RTTI*>(nullptr));
+			Assert::IsTrue(nullPointers == otherNullPointers);
+
+			Datum shared;
+			{
+				CopyOnWriteGuard guard;
+				shared = integers;
+			}
+			Assert::IsTrue(shared == integers);
+
+			Scope parent;
+			Scope& first = parent.AppendScope("Children");
+			Scope& second = parent.AppendScope("Children");
+			Scope& third = parent.AppendScope("Children");
+			Datum& children = parent["Children"];
+			children.RemoveAt(0);
+			Assert::AreEqual<size_t>(2, children.Size());
+			Assert::IsTrue(&second == &children[0]);
+			Assert::AreEqual<size_t>(1, children.Find(third));
+			children.PushBack(first);
+		}
+
+		TEST_METHOD(SpanAccessors)
+		{
+			Datum typeless;
+			Assert::IsTrue(typeless.AsSpan<float_t>().IsEmpty());
+
+			Datum floats;
+			for (int i = 0; i < 10; ++i)
+			{
+				floats.PushBack(static_cast<float_t>(i));
+			}
+			Span<float_t> span = floats.AsSpan<float_t>();
+			Assert::AreEqual<size_t>(10, span.Size());
+			for (float_t& value : span)
+			{
+				value *= 2.0f;
+			}
+			Assert::AreEqual(18.0f, floats.Get<float_t>(9));
+
+			const Datum& constFloats = floats;
+			float_t sum = 0.0f;
+			for (float_t value : constFloats.AsSpan<float_t>())
+			{
+				sum += value;
+			}
+			Assert::AreEqual(90.0f, sum);
+
+			auto expression = [&] { floats.AsSpan<int32_t>(); };
+			Assert::ExpectException<std::runtime_error>(expression);
+			auto expression2 = [&] { constFloats.AsSpan<glm::vec4>(); };
+			Assert::ExpectException<std::runtime_error>(expression2);
+
+			Datum strings;
+			strings.PushBack("Alpha"s);
+			strings.PushBack("Beta"s);
+			Assert::AreEqual("Beta"s, strings.AsSpan<std::string>().Back());
+
+			//A Datum that has handed out a span is copied rather than shared, the span could still write to it
+			Datum copy;
+			{
+				CopyOnWriteGuard guard;
+				copy = floats;
+			}
+			Assert::IsFalse(copy.IsShared());
+
+			//Writing through a span never shows through a copy sharing the buffer
+			Datum source;
+			source.PushBackRange(constFloats.AsSpan<float_t>().begin(), constFloats.AsSpan<float_t>().end());
+			const Datum& constSource = source;
+			{
+				CopyOnWriteGuard guard;
+				copy = source;
+			}
+			Assert::IsTrue(copy.IsShared());
+			const Datum& constCopy = copy;
+			Assert::IsTrue(constCopy.AsSpan<float_t>().begin() == constSource.AsSpan<float_t>().begin());
+			copy.AsSpan<float_t>()[0] = -1.0f;
+			Assert::IsFalse(copy.IsShared());
+			Assert::AreEqual(0.0f, constSource.Get<float_t>(0));
+			Assert::AreEqual(-1.0f, copy.Get<float_t>(0));
+		}
+
+		TEST_METHOD(RangeOperations)
+		{
+			const float_t values[] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f };
+			Datum floats;
+			floats.PushBackRange(std::begin(values), std::end(values));
+			Assert::IsTrue(floats.Type() == Datum::DatumType::FLOAT);
+			Assert::AreEqual<size_t>(9, floats.Size());
+			Assert::AreEqual(9.0f, floats.Get<float_t>(8));
+
+			floats.PushBackRange(values, values + 2);
+			Assert::AreEqual<size_t>(11, floats.Size());
+			Assert::AreEqual(2.0f, floats.Get<float_t>(10));
+
+			floats.SetRange(1, values + 6, values + 9);
+			Assert::AreEqual(7.0f, floats.Get<float_t>(1));
+			Assert::AreEqual(9.0f, floats.Get<float_t>(3));
+			Assert::AreEqual(5.0f, floats.Get<float_t>(4));
+
+			size_t capacity = floats.Capacity();
+			floats.Assign(values, values + 3);
+			Assert::AreEqual<size_t>(3, floats.Size());
+			Assert::AreEqual(capacity, floats.Capacity());
+			Assert::AreEqual(3.0f, floats.Get<float_t>(2));
+
+			auto expression = [&] { floats.SetRange(2, values, values + 2); };
+			Assert::ExpectException<std::runtime_error>(expression);
+			const int32_t integers[] = { 1, 2 };
+			auto expression2 = [&] { floats.PushBackRange(integers, integers + 2); };
+			Assert::ExpectException<std::runtime_error>(expression2);
+			auto expression3 = [&] { floats.SetRange(0, integers, integers + 1); };
+			Assert::ExpectException<std::runtime_error>(expression3);
+
+			float_t external[] = { 0.0f, 0.0f, 0.0f };
+			Datum externalFloats;
+			externalFloats.SetStorage(external, 3);
+			externalFloats.SetRange(0, values, values + 3);
+			Assert::AreEqual(2.0f, external[1]);
+			auto expression4 = [&] { externalFloats.PushBackRange(values, values + 1); };
+			Assert::ExpectException<std::runtime_error>(expression4);
+			auto expression5 = [&] { externalFloats.Assign(values, values + 1); };
+			Assert::ExpectException<std::runtime_error>(expression5);
+
+			const std::string names[] = { "Alpha"s, "Beta"s, "A string too long for the small string buffer"s };
+			Datum strings;
+			strings.PushBackRange(std::begin(names), std::end(names));
+			strings.SetRange(0, names + 2, names + 3);
+			Assert::AreEqual(names[2], strings.Get<std::string>(0));
+			strings.Assign(names, names + 2);
+			Assert::AreEqual<size_t>(2, strings.Size());
+			Assert::AreEqual("Beta"s, strings.Get<std::string>(1));
+
+			//Assigning to a shared buffer leaves the other Datum untouched
+			Datum copy;
+			{
+				CopyOnWriteGuard guard;
+				copy = floats;
+			}
+			copy.Assign(values + 4, values + 9);
+			Assert::IsFalse(copy.IsShared());
+			Assert::AreEqual<size_t>(3, floats.Size());
+			Assert::AreEqual(1.0f, floats.Get<float_t>(0));
+			Assert::AreEqual<size_t>(5, copy.Size());
+			Assert::AreEqual(9.0f, copy.Get<float_t>(4));
+		}
+
+		TEST_METHOD(SelfRangeOperations)
+		{
+			//Appending a Datum to itself grows it out of the buffer the range points into
+			const float_t values[] = { 1.0f, 2.0f, 3.0f };
+			Datum floats;
+			floats.PushBackRange(std::begin(values), std::end(values));
+			const Datum& constFloats = floats;
+			for (size_t i = 0; i < 3; ++i)
+			{
+				Span<const float_t> span = constFloats.AsSpan<float_t>();
+				floats.PushBackRange(span.begin(), span.end());
+			}
+			Assert::AreEqual<size_t>(24, floats.Size());
+			for (size_t i = 0; i < floats.Size(); ++i)
+			{
+				Assert::AreEqual(values[i % 3], floats.Get<float_t>(i));
+			}
+
+			const std::string names[] = { "A string too long for the small string buffer"s, "Beta"s, "Gamma"s };
+			Datum strings;
+			strings.PushBackRange(std::begin(names), std::end(names));
+			const Datum& constStrings = strings;
+			for (size_t i = 0; i < 3; ++i)
+			{
+				Span<const std::string> span = constStrings.AsSpan<std::string>();
+				strings.PushBackRange(span.begin() + 1, span.end());
+			}
+			Assert::AreEqual<size_t>(17, strings.Size());
+			Assert::AreEqual(names[0], strings.Get<std::string>(0));
+			Assert::AreEqual("Gamma"s, strings.Get<std::string>(16));
+
+			//Assigning a Datum its own elements keeps them rather than destroying them first
+			Span<const std::string> tail = constStrings.AsSpan<std::string>().Subspan(15);
+			strings.Assign(tail.begin(), tail.end());
+			Assert::AreEqual<size_t>(2, strings.Size());
+			Assert::AreEqual("Beta"s, strings.Get<std::string>(0));
+			Assert::AreEqual("Gamma"s, strings.Get<std::string>(1));
+			Span<const std::string> all = constStrings.AsSpan<std::string>();
+			strings.Assign(all.begin(), all.end());
+			Assert::AreEqual<size_t>(2, strings.Size());
+			Assert::AreEqual("Beta"s, strings.Get<std::string>(0));
+
+			Span<const float_t> middle = constFloats.AsSpan<float_t>().Subspan(1, 3);
+			floats.Assign(middle.begin(), middle.end());
+			Assert::AreEqual<size_t>(3, floats.Size());
+			Assert::AreEqual(2.0f, floats.Get<float_t>(0));
+			Assert::AreEqual(1.0f, floats.Get<float_t>(2));
+
+			//A shared buffer stays alive in the other Datum while the range is read out of it
+			Datum copy;
+			{
+				CopyOnWriteGuard guard;
+				copy = strings;
+			}
+			const Datum& constCopy = copy;
+			Span<const std::string> shared = constCopy.AsSpan<std::string>();
+			copy.Assign(shared.begin() + 1, shared.end());
+			Assert::AreEqual<size_t>(1, copy.Size());
+			Assert::AreEqual("Gamma"s, copy.Get<std::string>(0));
+			shared = constCopy.AsSpan<std::string>();
+			copy.PushBackRange(shared.begin(), shared.end());
+			Assert::AreEqual<size_t>(2, copy.Size());
+			Assert::AreEqual("Gamma"s, copy.Get<std::string>(1));
+			Assert::AreEqual<size_t>(2, strings.Size());
+		}
+
+		TEST_METHOD(TypedReference)
+		{
+			Datum typeless;
+			DatumRef<int32_t> integers(typeless);
+			Assert::IsTrue(typeless.Type() == Datum::DatumType::INTEGER);
+			Assert::IsTrue(integers.IsEmpty());
+			for (int32_t i = 0; i < 20; ++i)
+			{
+				integers.PushBack(i);
+			}
+			Assert::AreEqual<size_t>(20, integers.Size());
+			Assert::AreEqual(19, typeless.Get<int32_t>(19));
+			integers.Set(-1, 3);
+			++integers[4];
+			Assert::AreEqual(-1, integers.Get(3));
+			Assert::AreEqual(5, typeless.Get<int32_t>(4));
+
+			int32_t sum = 0;
+			for (int32_t value : static_cast<const DatumRef<int32_t>&>(integers))
+			{
+				sum += value;
+			}
+			Assert::AreEqual(187, sum);
+			for (int32_t& value : integers)
+			{
+				value = 0;
+			}
+			Assert::AreEqual(0, typeless.Get<int32_t>(19));
+
+			auto expression = [&] { DatumRef<float_t> floats(typeless); };
+			Assert::ExpectException<std::runtime_error>(expression);
+
+			Datum strings;
+			strings.PushBack("Alpha"s);
+			DatumRef<std::string> stringRef(strings);
+			stringRef.PushBack("A string too long for the small string buffer"s);
+			stringRef.PushBack("Gamma"s);
+			Assert::AreEqual("Gamma"s, strings.Get<std::string>(2));
+			stringRef[0] += "Beta"s;
+			Assert::AreEqual("AlphaBeta"s, stringRef.Get());
+
+			//Pushing onto external storage fails the same way Datum::PushBack does
+			float_t external[] = { 1.0f, 2.0f };
+			Datum externalFloats;
+			externalFloats.SetStorage(external, 2);
+			DatumRef<float_t> externalRef(externalFloats);
+			externalRef.Set(3.0f, 1);
+			Assert::AreEqual(3.0f, external[1]);
+			auto expression2 = [&] { externalRef.PushBack(4.0f); };
+			Assert::ExpectException<std::runtime_error>(expression2);
+
+			//typeless has handed out references, so copies of it never share its buffer
+			Datum copy;
+			{
+				CopyOnWriteGuard guard;
+				copy = typeless;
+			}
+			Assert::IsFalse(copy.IsShared());
+
+			//Writes copy a shared buffer first
+			Datum source;
+			DatumRef<int32_t> sourceRef(source);
+			for (int32_t i = 0; i < 20; ++i)
+			{
+				sourceRef.PushBack(0);
+			}
+			{
+				CopyOnWriteGuard guard;
+				copy = source;
+			}
+			DatumRef<int32_t> copyRef(copy);
+			Assert::IsTrue(copy.IsShared());
+			Assert::AreEqual(0, copyRef.Get(0));
+			Assert::IsTrue(copy.IsShared());
+			copyRef.Set(7);
+			Assert::IsFalse(copy.IsShared());
+			Assert::AreEqual(0, sourceRef.Get(0));
+			Assert::AreEqual(7, copy.Get<int32_t>(0));
+
+			//Writes to an attribute mark the scope's structural hash stale
+			Scope scope;
+			scope["Health"] = 100;
+			DatumRef<int32_t> health(scope["Health"]);
+			const size_t hash = scope.StructuralHash();
+			health.Set(50);
+			Assert::AreNotEqual(hash, scope.StructuralHash());
+			health.Set(100);
+			Assert::AreEqual(hash, scope.StructuralHash());
+			health.PushBack(1);
+			Assert::AreNotEqual(hash, scope.StructuralHash());
+			Assert::AreEqual(1, scope["Health"].Get<int32_t>(1));
+		}
+
 		TEST_METHOD(Remove)
 		{
 			Datum temp_int;
@@ -1089,6 +1552,105 @@ namespace UnitTestLibraryDesktop
 				delete[] foos;*/
 			}
 		}
+
+		TEST_METHOD(ShrinkToFit)
+		{
+			Datum integers;
+			integers.SetType(Datum::DatumType::INTEGER);
+			integers.Reserve(32);
+			integers.PushBack(1);
+			integers.PushBack(2);
+			MemoryFootprint footprint = integers.Footprint();
+			Assert::AreEqual(2 * sizeof(int32_t), footprint.DatumElements);
+			Assert::AreEqual(30 * sizeof(int32_t), footprint.DatumSlack);
+
+			//Two integers fit in the inline storage, so nothing is left on the heap
+			integers.ShrinkToFit();
+			Assert::IsTrue(integers.IsInline());
+			Assert::AreEqual<size_t>(2, integers.Capacity());
+			Assert::AreEqual(size_t(0), integers.Footprint().Total());
+			Assert::AreEqual(2, integers.Get<int32_t>(1));
+
+			Datum strings;
+			const std::string longString(100, 'a');
+			strings = longString;
+			strings.PushBack("short"s);
+			strings.PushBack("shorter"s);
+			strings.ShrinkToFit();
+			Assert::AreEqual<size_t>(3, strings.Capacity());
+			Assert::AreEqual(longString, strings.Get<std::string>(0));
+			footprint = strings.Footprint();
+			Assert::AreEqual(3 * sizeof(std::string), footprint.DatumElements);
+			Assert::AreEqual(size_t(0), footprint.DatumSlack);
+			Assert::IsTrue(footprint.Strings > longString.size());
+
+			int32_t external[4] = { 1, 2, 3, 4 };
+			Datum externalDatum;
+			externalDatum.SetStorage(external, 2);
+			externalDatum.ShrinkToFit();
+			Assert::AreEqual(size_t(0), externalDatum.Footprint().Total());
+			Assert::AreEqual<size_t>(2, externalDatum.Size());
+		}
+
+		TEST_METHOD(CopyOnWrite)
+		{
+			Datum strings;
+			strings = "Alpha"s;
+			strings.PushBack("Beta"s);
+			strings.PushBack("Gamma"s);
+			Datum integers;
+			integers = 1;
+			integers.PushBack(2);
+			integers.PushBack(3);
+			integers.PushBack(4);
+			integers.PushBack(5);
+
+			Datum unsharedCopy(strings);
+			Assert::IsFalse(strings.IsShared());
+
+			{
+				CopyOnWriteGuard guard;
+				Datum sharedStrings(strings);
+				Datum sharedIntegers;
+				sharedIntegers = integers;
+				Assert::IsTrue(strings.IsShared());
+				Assert::IsTrue(sharedStrings.IsShared());
+				Assert::IsTrue(integers.IsShared());
+				const Datum& constStrings = sharedStrings;
+				Assert::IsTrue(&constStrings.Get<std::string>(1) == &static_cast<const Datum&>(strings).Get<std::string>(1));
+				Assert::AreEqual("Gamma"s, sharedStrings.ToString(2));
+				Assert::IsTrue(sharedStrings.IsShared());
+
+				//The first write through either side copies the buffer
+				sharedStrings.Set("Delta"s, 1);
+				Assert::IsFalse(sharedStrings.IsShared());
+				Assert::IsFalse(strings.IsShared());
+				Assert::AreEqual("Beta"s, static_cast<const Datum&>(strings).Get<std::string>(1));
+				Assert::AreEqual("Delta"s, sharedStrings.Get<std::string>(1));
+
+				integers.PushBack(6);
+				Assert::IsFalse(sharedIntegers.IsShared());
+				Assert::AreEqual<size_t>(5, sharedIntegers.Size());
+				Assert::AreEqual(5, sharedIntegers.Back<int32_t>());
+				Assert::AreEqual<size_t>(6, integers.Size());
+
+				Datum third(strings);
+				Datum fourth(strings);
+				fourth.Clear();
+				Assert::IsTrue(third.IsShared());
+				Assert::AreEqual("Alpha"s, third.Front<std::string>());
+				third.Get<std::string>(0) = "Omega"s;
+				Assert::AreEqual("Alpha"s, strings.Front<std::string>());
+
+				//Small buffers live inside the Datum and are always copied
+				Datum small;
+				small = 7;
+				Datum smallCopy(small);
+				Assert::IsFalse(small.IsShared());
+			}
+			Assert::IsFalse(CopyOnWriteGuard::IsActive());
+			Assert::IsTrue(unsharedCopy == strings);
+		}
 	private:
 		static _CrtMemState sStartMemState;
 	};
@@ -1,5 +1,7 @@
 #include "pch.h"
 #include "Avatar.h"
+#include "JsonTableParseHelper.h"
+#include "PrototypeRegistry.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace Library;
@@ -64,6 +66,7 @@ namespace UnitTests
 
 		TEST_METHOD_CLEANUP(Cleanup)
 		{
+			ObjectPool::Trim();
 #if defined(DEBUG) || defined(_DEBUG)
 			_CrtMemState end_mem_state, diff_mem_state;
 			_CrtMemCheckpoint(&end_mem_state);
@@ -160,6 +163,85 @@ namespace UnitTests
 			Assert::AreEqual(&sector2, entity->GetSector());
 		}
 
+		TEST_METHOD(Prototypes)
+		{
+			EntityFactory entityFactory;
+			{
+				Scope definitions;
+				const string input = R"({ "Goblin": { "Class": "Entity", "DefinePrototype": "Goblin", "Type": "table", "Value": { "Name": { "Type": "string", "Value": "Goblin" }, "Loot": { "Type": "integer", "Value": [ 1, 2, 3, 4, 5, 6, 7, 8 ] } } } })";
+				JsonTableParseHelper::SharedData sharedData(definitions);
+				JsonTableParseHelper parseHelper;
+				JsonParseMaster parseMaster(sharedData);
+				parseMaster.AddHelper(parseHelper);
+				parseMaster.Parse(input);
+				Assert::IsNull(definitions.Find("Goblin"));
+			}
+			Assert::AreEqual(size_t(1), PrototypeRegistry::Size());
+			const Scope* goblin = PrototypeRegistry::Find("Goblin");
+			Assert::IsNotNull(goblin);
+			Assert::IsTrue(goblin->Is(Entity::TypeIdClass()));
+			Assert::IsNull(goblin->GetParent());
+
+			Sector sector("Cave");
+			{
+				const string input = R"({ "Entities": { "Type": "table", "Value": [ { "CloneOf": "Goblin", "Type": "table", "Value": { "Name": { "Type": "string", "Value": "Boss" } } }, { "CloneOf": "Goblin", "Type": "table", "Value": {} } ] } })";
+				JsonTableParseHelper::SharedData sharedData(sector);
+				JsonTableParseHelper parseHelper;
+				JsonParseMaster parseMaster(sharedData);
+				parseMaster.AddHelper(parseHelper);
+				parseMaster.Parse(input);
+			}
+			Assert::AreEqual(size_t(2), sector.Entities().Size());
+			Entity* boss = sector.Entities()[0].As<Entity>();
+			Entity* grunt = sector.Entities()[1].As<Entity>();
+			Assert::IsNotNull(boss);
+			Assert::IsNotNull(grunt);
+			Assert::AreEqual("Boss"s, boss->Name());
+			Assert::AreEqual("Goblin"s, grunt->Name());
+			Assert::AreEqual("Goblin"s, static_cast<const Entity*>(goblin)->Name());
+			Assert::IsTrue(grunt->At("Loot").IsShared());
+			grunt->At("Loot").Set(10, 0);
+			Assert::AreEqual(10, grunt->At("Loot").Get<int32_t>(0));
+			Assert::AreEqual(1, boss->At("Loot").Get<int32_t>(0));
+			Assert::AreEqual(1, (*goblin)["Loot"].Get<int32_t>(0));
+
+			Entity* spawned = sector.CreateEntity("Goblin", "Spawned");
+			Assert::IsNotNull(spawned);
+			Assert::AreEqual(&sector, spawned->GetSector());
+			Assert::AreEqual("Spawned"s, spawned->Name());
+			Assert::AreEqual(8, spawned->At("Loot").Get<int32_t>(7));
+			Assert::AreEqual(size_t(3), sector.Entities().Size());
+
+			//A prototype of the wrong type is rejected and its clone deleted, instead of being cast
+			PrototypeRegistry::Register("Crate", new Scope());
+			Assert::IsNull(sector.CreateEntity("Crate", "Box"));
+			Assert::AreEqual(size_t(3), sector.Entities().Size());
+			auto expression = [&] { spawned->CreateAction("Crate", "Lid"); };
+			Assert::ExpectException<std::runtime_error>(expression);
+
+			//Conflicting directives are rejected instead of one of them being dropped
+			auto parse = [](Scope& root, const string& input)
+			{
+				JsonTableParseHelper::SharedData sharedData(root);
+				JsonTableParseHelper parseHelper;
+				JsonParseMaster parseMaster(sharedData);
+				parseMaster.AddHelper(parseHelper);
+				parseMaster.Parse(input);
+			};
+			auto cloneWithClass = [&] { Sector cave("Cave"); parse(cave, R"({ "Entities": { "Type": "table", "Value": [ { "Class": "Entity", "CloneOf": "Goblin", "Type": "table", "Value": {} } ] } })"); };
+			Assert::ExpectException<std::runtime_error>(cloneWithClass);
+			auto cloneOverExisting = [&] { parse(sector, R"({ "Entities": { "Type": "table", "Value": [ { "CloneOf": "Goblin", "Type": "table", "Value": {} } ] } })"); };
+			Assert::ExpectException<std::runtime_error>(cloneOverExisting);
+			auto classOverExisting = [&] { parse(sector, R"({ "Entities": { "Type": "table", "Value": [ { "Class": "Sector", "Type": "table", "Value": { "Name": { "Type": "string", "Value": "Boss" } } } ] } })"); };
+			Assert::ExpectException<std::runtime_error>(classOverExisting);
+			parse(sector, R"({ "Entities": { "Type": "table", "Value": [ { "Class": "Entity", "Type": "table", "Value": { "Name": { "Type": "string", "Value": "Chief" } } } ] } })");
+			Assert::AreEqual("Chief"s, boss->Name());
+			Assert::AreEqual(size_t(3), sector.Entities().Size());
+
+			PrototypeRegistry::Clear();
+			Assert::AreEqual(size_t(0), PrototypeRegistry::Size());
+		}
+
 		TEST_METHOD(WorldGetSet)
 		{
 			World world("World");
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "JsonTableParseHelper.h"
+#include "HashMap.h"
 #include "CppUnitTest.h"
 
 
@@ -28,6 +29,7 @@ namespace UnitTestLibraryDesktop
 
 		TEST_METHOD_CLEANUP(Cleanup)
 		{
+			ObjectPool::Trim();
 
 #if defined(DEBUG) || defined(_DEBUG)
 			_CrtMemState end_mem_state, diff_mem_state;
@@ -88,6 +90,43 @@ namespace UnitTestLibraryDesktop
 			delete pointer;
 		}
 
+		TEST_METHOD(TableType)
+		{
+			//A factory over another map keeps a registry of its own
+			class ChainedFooFactory final : public Factory<RTTI, HashMap>
+			{
+			public:
+				ChainedFooFactory() : mClassName("Foo"s)
+				{
+					Add(*this);
+				}
+				~ChainedFooFactory()
+				{
+					Remove(*this);
+				}
+				virtual const std::string& ClassName() const override
+				{
+					return mClassName;
+				}
+				virtual gsl::owner<RTTI*> Create() override
+				{
+					return new Foo();
+				}
+
+			private:
+				const std::string mClassName;
+			};
+
+			ChainedFooFactory chainedFactory;
+			Assert::IsTrue(Factory<RTTI, HashMap>::Find("Foo"s) == &chainedFactory);
+			Assert::IsNull(Factory<RTTI>::Find("Foo"s));
+			FooFactory fooFactory;
+			Assert::AreEqual<size_t>(1, Factory<RTTI, HashMap>::GetFactoryTableSize());
+			RTTI* pointer = Factory<RTTI, HashMap>::Create("Foo"s);
+			Assert::IsTrue(pointer->Is(Foo::TypeIdClass()));
+			delete pointer;
+		}
+
 		TEST_METHOD(TestRTTI)
 		{
 			Foo a(100);
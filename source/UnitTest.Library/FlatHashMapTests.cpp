@@ -0,0 +1,242 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "FlatHashMap.h"
+#include <string>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Library;
+using namespace std::string_literals;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(FlatHashMapTests)
+	{
+	public:
+
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Constructor)
+		{
+			FlatHashMap<std::string, int> hashmap(10);
+			Assert::AreEqual<size_t>(0, hashmap.Size());
+			Assert::AreEqual<size_t>(16, hashmap.NumberOfBuckets());
+			Assert::IsTrue(hashmap.begin() == hashmap.end());
+
+			FlatHashMap<std::string, int> listmap{ { "a"s, 1 }, { "b"s, 2 } };
+			Assert::AreEqual<size_t>(2, listmap.Size());
+			Assert::AreEqual(2, listmap.At("b"s));
+		}
+
+		TEST_METHOD(InsertAndFind)
+		{
+			FlatHashMap<std::string, int> hashmap;
+			bool inserted = false;
+
+			auto iter = hashmap.Insert(std::make_pair("Name"s, 10), inserted);
+			Assert::IsTrue(inserted);
+			Assert::AreEqual(10, iter->second);
+
+			iter = hashmap.Insert(std::make_pair("Name"s, 20), inserted);
+			Assert::IsFalse(inserted);
+			Assert::AreEqual(10, iter->second);
+			Assert::AreEqual<size_t>(1, hashmap.Size());
+
+			hashmap.Insert(std::make_pair("Actions"s, 30));
+			Assert::IsTrue(hashmap.Find("Actions"s) != hashmap.end());
+			Assert::IsTrue(hashmap.Find("Target"s) == hashmap.end());
+
+			const FlatHashMap<std::string, int> constHashmap = hashmap;
+			Assert::AreEqual(30, constHashmap.Find("Actions"s)->second);
+			Assert::IsTrue(constHashmap.Find("Target"s) == constHashmap.end());
+		}
+
+		TEST_METHOD(HeterogeneousLookup)
+		{
+			FlatHashMap<std::string, int> hashmap;
+			hashmap["Name"s] = 1;
+			hashmap["Entities"s] = 2;
+
+			std::string_view text = "Entities Sectors";
+			Assert::IsTrue(hashmap.Find(text.substr(0, 8)) != hashmap.end());
+			Assert::IsTrue(hashmap.Find(text.substr(9)) == hashmap.end());
+			Assert::IsTrue(hashmap.ContainsKey("Name"));
+			Assert::IsFalse(hashmap.ContainsKey("Nam"));
+			Assert::AreEqual(2, hashmap.At(text.substr(0, 8)));
+
+			const char* name = "Name";
+			const FlatHashMap<std::string, int>& constHashmap = hashmap;
+			Assert::AreEqual(1, constHashmap.At(name));
+			Assert::AreEqual(1, constHashmap.Find(std::string_view(name))->second);
+			auto expression = [&] { constHashmap.At(text); };
+			Assert::ExpectException<std::runtime_error>(expression);
+		}
+
+		TEST_METHOD(IndexOperatorAndAt)
+		{
+			FlatHashMap<std::string, int> hashmap;
+			hashmap["a"s] = 1;
+			hashmap["b"s] = 2;
+			hashmap["a"s] = 3;
+
+			Assert::AreEqual<size_t>(2, hashmap.Size());
+			Assert::AreEqual(3, hashmap.At("a"s));
+			Assert::AreEqual(2, hashmap.At("b"s));
+
+			auto expression = [&] { hashmap.At("c"s); };
+			Assert::ExpectException<std::runtime_error>(expression);
+
+			const FlatHashMap<std::string, int>& constHashmap = hashmap;
+			Assert::AreEqual(2, constHashmap.At("b"s));
+		}
+
+		TEST_METHOD(Remove)
+		{
+			FlatHashMap<size_t, size_t> hashmap;
+			for (size_t i = 0; i < 100; ++i)
+			{
+				hashmap[i] = i * 2;
+			}
+
+			for (size_t i = 0; i < 100; i += 2)
+			{
+				hashmap.Remove(i);
+			}
+			hashmap.Remove(1000);
+
+			Assert::AreEqual<size_t>(50, hashmap.Size());
+			for (size_t i = 0; i < 100; ++i)
+			{
+				Assert::AreEqual(i % 2 == 1, hashmap.ContainsKey(i));
+			}
+
+			//Removed entries are reused by later inserts
+			hashmap[1000] = 1;
+			Assert::AreEqual<size_t>(51, hashmap.Size());
+			Assert::AreEqual<size_t>(1, hashmap.At(1000));
+		}
+
+		TEST_METHOD(GrowthKeepsReferencesValid)
+		{
+			FlatHashMap<std::string, int> hashmap(2);
+			Vector<FlatHashMap<std::string, int>::PairType*> pointers;
+
+			for (int i = 0; i < 500; ++i)
+			{
+				pointers.PushBack(&*hashmap.Insert(std::make_pair(std::to_string(i), i)));
+			}
+			Assert::IsTrue(hashmap.NumberOfBuckets() >= 512);
+			Assert::IsTrue(hashmap.LoadFactor() <= 0.8f);
+
+			hashmap.Rehash(4096);
+			Assert::AreEqual<size_t>(4096, hashmap.NumberOfBuckets());
+
+			for (int i = 0; i < 500; ++i)
+			{
+				Assert::IsTrue(pointers[i] == &*hashmap.Find(std::to_string(i)));
+				Assert::AreEqual(i, pointers[i]->second);
+			}
+		}
+
+		TEST_METHOD(Iteration)
+		{
+			FlatHashMap<size_t, size_t> hashmap;
+			for (size_t i = 0; i < 50; ++i)
+			{
+				hashmap[i] = i;
+			}
+			hashmap.Remove(0);
+			hashmap.Remove(25);
+
+			size_t count = 0;
+			size_t sum = 0;
+			for (const auto& pair : hashmap)
+			{
+				++count;
+				sum += pair.second;
+			}
+			Assert::AreEqual<size_t>(48, count);
+			Assert::AreEqual<size_t>((49 * 50) / 2 - 25, sum);
+
+			//Entries are visited in insertion order when nothing has been reused
+			auto iter = hashmap.begin();
+			Assert::AreEqual<size_t>(1, iter->first);
+			Assert::AreEqual<size_t>(2, (++iter)->first);
+
+			const FlatHashMap<size_t, size_t>& constHashmap = hashmap;
+			count = 0;
+			for (auto constIter = constHashmap.cbegin(); constIter != constHashmap.cend(); ++constIter)
+			{
+				++count;
+			}
+			Assert::AreEqual<size_t>(48, count);
+
+			auto endIter = hashmap.end();
+			auto expression = [&] { ++endIter; };
+			Assert::ExpectException<std::runtime_error>(expression);
+		}
+
+		TEST_METHOD(CopyAndMove)
+		{
+			FlatHashMap<std::string, int> hashmap;
+			hashmap["a"s] = 1;
+			hashmap["b"s] = 2;
+
+			FlatHashMap<std::string, int> copy(hashmap);
+			copy["a"s] = 10;
+			Assert::AreEqual(1, hashmap.At("a"s));
+			Assert::AreEqual(10, copy.At("a"s));
+
+			FlatHashMap<std::string, int> moved(std::move(copy));
+			Assert::AreEqual<size_t>(2, moved.Size());
+			Assert::AreEqual<size_t>(0, copy.Size());
+
+			copy["c"s] = 3;
+			Assert::AreEqual(3, copy.At("c"s));
+
+			copy = hashmap;
+			Assert::AreEqual<size_t>(2, copy.Size());
+			Assert::IsFalse(copy.ContainsKey("c"s));
+
+			moved = std::move(copy);
+			Assert::AreEqual(1, moved.At("a"s));
+		}
+
+		TEST_METHOD(Clear)
+		{
+			FlatHashMap<std::string, int> hashmap;
+			hashmap["a"s] = 1;
+			hashmap["b"s] = 2;
+			hashmap.Clear();
+
+			Assert::AreEqual<size_t>(0, hashmap.Size());
+			Assert::IsTrue(hashmap.begin() == hashmap.end());
+			Assert::IsFalse(hashmap.ContainsKey("a"s));
+
+			hashmap["a"s] = 3;
+			Assert::AreEqual(3, hashmap.At("a"s));
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+	_CrtMemState FlatHashMapTests::sStartMemState;
+}
@@ -91,6 +91,37 @@ namespace UnitTestLibraryDesktop
 			Assert::AreNotEqual(hash(b), hash(a));
 		}
 
+		TEST_METHOD(HashFunctionString)
+		{
+			HashFunctions<std::string> hash;
+			HashFunctions<const char*> constCharHash;
+
+			//Anagrams no longer collide
+			Assert::AreNotEqual(hash("ab"), hash("ba"));
+			Assert::AreNotEqual(hash("Name"), hash("Nmae"));
+			Assert::AreNotEqual(hash(""), hash(std::string(1, '\0')));
+
+			//Strings and C strings with the same characters hash alike
+			Assert::AreEqual(hash("Entities"), constCharHash("Entities"));
+			std::string longKey(100, 'x');
+			Assert::AreEqual(hash(longKey), constCharHash(longKey.c_str()));
+			longKey[50] = 'y';
+			Assert::AreNotEqual(hash(longKey), hash(std::string(100, 'x')));
+		}
+
+		TEST_METHOD(HashFunctionInteger)
+		{
+			HashFunctions<size_t> hash;
+			HashFunctions<int*> pointerHash;
+			int values[2];
+
+			//Neighbouring keys differ in their low bits, which is what bucket indexing uses
+			Assert::AreNotEqual(hash(0) & 0xff, hash(1) & 0xff);
+			Assert::AreNotEqual(hash(64) & 0xff, hash(128) & 0xff);
+			Assert::AreEqual(pointerHash(&values[0]), pointerHash(&values[0]));
+			Assert::AreNotEqual(pointerHash(&values[0]), pointerHash(&values[1]));
+		}
+
 		TEST_METHOD(HashFunctionFoo)
 		{
 			HashFunctions<Foo> hash;
@@ -312,6 +343,110 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(20, hashmap[b]);
 			Assert::AreEqual(30, hashmap[c]);
 			Assert::AreEqual<size_t>(27, hashmap.NumberOfBuckets());
+
+			//Entries are relinked rather than copied
+			int* address = &hashmap[a];
+			hashmap.Rehash(7);
+			Assert::IsTrue(address == &hashmap[a]);
+			Assert::AreEqual<size_t>(3, hashmap.Size());
+
+			auto expression = [&] { hashmap.Rehash(0); };
+			Assert::ExpectException<std::runtime_error>(expression);
+		}
+
+		TEST_METHOD(HeterogeneousLookup)
+		{
+			HashMap<std::string, int> hashmap;
+			hashmap["Name"] = 1;
+			hashmap["Entities"] = 2;
+
+			std::string_view text = "Entities Sectors";
+			Assert::IsTrue(hashmap.Find(text.substr(0, 8)) != hashmap.end());
+			Assert::IsTrue(hashmap.Find(text.substr(9)) == hashmap.end());
+			Assert::IsTrue(hashmap.ContainsKey("Name"));
+			Assert::AreEqual(2, hashmap.At(text.substr(0, 8)));
+
+			const HashMap<std::string, int>& constHashmap = hashmap;
+			Assert::AreEqual(1, constHashmap.At("Name"));
+			Assert::AreEqual(2, constHashmap.Find(text.substr(0, 8))->second);
+			auto expression = [&] { constHashmap.At(text); };
+			Assert::ExpectException<std::runtime_error>(expression);
+		}
+
+		TEST_METHOD(AutomaticGrowth)
+		{
+			HashMap<Foo, int> hashmap;
+			Assert::AreEqual(1.0f, hashmap.MaxLoadFactor());
+			Assert::AreEqual<size_t>(5, hashmap.NumberOfBuckets());
+
+			for (int i = 0; i < 100; ++i)
+			{
+				hashmap.Insert(HashMap<Foo, int>::PairType(Foo(i), i));
+			}
+			Assert::AreEqual<size_t>(100, hashmap.Size());
+			Assert::IsTrue(hashmap.NumberOfBuckets() >= 100);
+			for (int i = 0; i < 100; ++i)
+			{
+				Assert::AreEqual(i, hashmap.At(Foo(i)));
+			}
+
+			HashMap<Foo, int> fixedmap;
+			fixedmap.SetMaxLoadFactor(0.0f);
+			for (int i = 0; i < 100; ++i)
+			{
+				fixedmap.Insert(HashMap<Foo, int>::PairType(Foo(i), i));
+			}
+			Assert::AreEqual<size_t>(5, fixedmap.NumberOfBuckets());
+
+			auto expression = [&] { fixedmap.SetMaxLoadFactor(-1.0f); };
+			Assert::ExpectException<std::runtime_error>(expression);
+		}
+
+		TEST_METHOD(IncrementalRehash)
+		{
+			HashMap<Foo, int> hashmap;
+			hashmap.SetIncrementalRehash(true);
+			Assert::IsTrue(hashmap.IsIncrementalRehash());
+
+			Vector<int*> addresses;
+			bool sawRehash = false;
+			for (int i = 0; i < 200; ++i)
+			{
+				addresses.PushBack(&hashmap.Insert(HashMap<Foo, int>::PairType(Foo(i), i))->second);
+				sawRehash = sawRehash || hashmap.IsRehashing();
+
+				//Every entry stays reachable while old buckets are drained
+				Assert::IsTrue(hashmap.ContainsKey(Foo(0)));
+				Assert::IsTrue(hashmap.ContainsKey(Foo(i)));
+			}
+			Assert::IsTrue(sawRehash);
+
+			size_t count = 0;
+			for (const auto& pair : hashmap)
+			{
+				Assert::IsTrue(addresses[pair.second] == &pair.second);
+				++count;
+			}
+			Assert::AreEqual<size_t>(200, count);
+
+			const HashMap<Foo, int>& constHashmap = hashmap;
+			for (int i = 0; i < 200; ++i)
+			{
+				Assert::AreEqual(i, constHashmap.At(Foo(i)));
+			}
+
+			hashmap.Remove(Foo(0));
+			hashmap.FinishRehash();
+			Assert::IsFalse(hashmap.IsRehashing());
+			Assert::AreEqual<size_t>(199, hashmap.Size());
+			for (int i = 1; i < 200; ++i)
+			{
+				Assert::IsTrue(addresses[i] == &hashmap.At(Foo(i)));
+			}
+
+			hashmap.Clear();
+			Assert::AreEqual<size_t>(0, hashmap.Size());
+			Assert::IsTrue(hashmap.begin() == hashmap.end());
 		}
 
 		TEST_METHOD(Begin)
@@ -0,0 +1,128 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "InternedString.h"
+#include <string>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Library;
+using namespace std::string_literals;
+
+namespace UnitTestLibraryDesktop
+{
+	namespace
+	{
+		//Interned before any test runs so the intern table allocations are not reported as leaks
+		const InternedString sHealth("Health");
+		const InternedString sMana("Mana");
+	}
+
+	TEST_CLASS(InternedStringTests)
+	{
+	public:
+
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			ObjectPool::Trim();
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Interning)
+		{
+			size_t count = InternedString::InternedCount();
+			InternedString health("Health");
+			std::string_view text = "Mana Health";
+			InternedString mana(text.substr(0, 4));
+
+			Assert::AreEqual(count, InternedString::InternedCount());
+			Assert::IsTrue(&health.String() == &sHealth.String());
+			Assert::IsTrue(health == sHealth);
+			Assert::IsTrue(mana == sMana);
+			Assert::IsTrue(health != mana);
+			Assert::AreEqual("Health"s, health.String());
+
+			InternedString empty;
+			Assert::IsTrue(empty.String().empty());
+			Assert::IsTrue(empty == InternedString(""));
+		}
+
+		TEST_METHOD(Hash)
+		{
+			HashFunctions<std::string> stringHash;
+			Assert::AreEqual(stringHash("Health"s), sHealth.Hash());
+			Assert::AreEqual(stringHash("Mana"s), sMana.Hash());
+			Assert::AreEqual(sHealth.Hash(), HashFunctions<InternedString>{}(sHealth));
+			Assert::AreEqual(sHealth.Hash(), stringHash(sHealth));
+
+			Assert::IsTrue("Health"s == sHealth);
+			Assert::IsTrue(sMana == "Mana"s);
+			Assert::IsTrue("Mana"s != sHealth);
+		}
+
+		TEST_METHOD(HashMapLookup)
+		{
+			HashMap<std::string, int> hashmap;
+			hashmap["Health"] = 100;
+			Assert::IsTrue(hashmap.ContainsKey(sHealth));
+			Assert::IsFalse(hashmap.ContainsKey(sMana));
+			Assert::AreEqual(100, hashmap.At(sHealth));
+
+			FlatHashMap<std::string, int> flatmap;
+			flatmap["Mana"s] = 50;
+			Assert::AreEqual(50, flatmap.Find(sMana)->second);
+			Assert::IsTrue(flatmap.Find(sHealth) == flatmap.end());
+
+			HashMap<InternedString, int> internedmap;
+			internedmap.Insert(std::make_pair(sHealth, 1));
+			internedmap.Insert(std::make_pair(sMana, 2));
+			Assert::AreEqual(1, internedmap.At(sHealth));
+			Assert::AreEqual(2, internedmap.At(sMana));
+		}
+
+		TEST_METHOD(ScopeLookup)
+		{
+			Scope scope;
+			Datum& health = scope.Append(sHealth);
+			Assert::IsTrue(&health == &scope.Append("Health"));
+			Assert::IsTrue(&health == scope.Find(sHealth));
+			Assert::IsTrue(&health == &scope.At(sHealth));
+			Assert::IsTrue(&health == &scope[sHealth]);
+			Assert::IsNull(scope.Find(sMana));
+			Assert::AreEqual<size_t>(1, scope.Size());
+
+			Scope& child = scope.AppendScope("Child");
+			Scope* owner = nullptr;
+			Assert::IsTrue(&health == child.Search(sHealth, &owner));
+			Assert::IsTrue(owner == &scope);
+			Assert::IsNull(child.Search(sMana, &owner));
+			Assert::IsNull(owner);
+
+			const Scope& constScope = scope;
+			Assert::IsTrue(&health == constScope.Find(sHealth));
+			Assert::IsTrue(&health == &constScope[sHealth]);
+			auto expression = [&] { constScope.At(sMana); };
+			Assert::ExpectException<std::runtime_error>(expression);
+			auto emptyExpression = [&] { scope.Append(InternedString()); };
+			Assert::ExpectException<std::runtime_error>(emptyExpression);
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+	_CrtMemState InternedStringTests::sStartMemState;
+}
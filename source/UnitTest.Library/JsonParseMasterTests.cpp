@@ -56,6 +56,7 @@ namespace UnitTestLibraryDesktop
 
 		TEST_METHOD_CLEANUP(Cleanup)
 		{
+			ObjectPool::Trim();
 
 #if defined(DEBUG) || defined(_DEBUG)
 			_CrtMemState end_mem_state, diff_mem_state;
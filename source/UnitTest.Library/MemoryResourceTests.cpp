@@ -0,0 +1,261 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "ArenaResource.h"
+#include "PoolResource.h"
+#include "ObjectPool.h"
+#include <string>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace Library;
+using namespace std::string_literals;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(MemoryResourceTests)
+	{
+	public:
+
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			ObjectPool::Trim();
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(Default)
+		{
+			Assert::IsTrue(&MemoryResource::Default() == &MemoryResource::Heap());
+
+			ArenaResource arena;
+			{
+				DefaultResourceGuard guard(arena);
+				Assert::IsTrue(&MemoryResource::Default() == &arena);
+
+				ArenaResource inner;
+				{
+					DefaultResourceGuard innerGuard(inner);
+					Assert::IsTrue(&MemoryResource::Default() == &inner);
+				}
+				Assert::IsTrue(&MemoryResource::Default() == &arena);
+			}
+			Assert::IsTrue(&MemoryResource::Default() == &MemoryResource::Heap());
+		}
+
+		TEST_METHOD(Arena)
+		{
+			auto expression = [] { ArenaResource arena(0); };
+			Assert::ExpectException<std::runtime_error>(expression);
+
+			ArenaResource arena(256);
+			Assert::AreEqual<size_t>(0, arena.BytesReserved());
+
+			void* first = arena.Allocate(10);
+			void* second = arena.Allocate(1);
+			Assert::AreEqual<size_t>(0, reinterpret_cast<std::uintptr_t>(first) % MemoryResource::ALIGNMENT);
+			Assert::AreEqual<size_t>(0, reinterpret_cast<std::uintptr_t>(second) % MemoryResource::ALIGNMENT);
+			Assert::IsTrue(first != second);
+			Assert::AreEqual<size_t>(256, arena.BytesReserved());
+
+			//Only the most recent block is rolled back or grown in place
+			arena.Deallocate(first, 10);
+			size_t used = arena.BytesUsed();
+			Assert::IsTrue(second == arena.Reallocate(second, 1, 100));
+			Assert::IsTrue(arena.BytesUsed() > used);
+			arena.Deallocate(second, 100);
+			Assert::IsTrue(second == arena.Allocate(1));
+
+			memset(first, 7, 10);
+			void* moved = arena.Reallocate(first, 10, 40);
+			Assert::IsTrue(moved != first);
+			Assert::AreEqual<int>(7, static_cast<unsigned char*>(moved)[9]);
+
+			void* large = arena.Allocate(1000);
+			Assert::IsNotNull(large);
+			Assert::IsTrue(arena.BytesReserved() >= 1256);
+
+			size_t reserved = arena.BytesReserved();
+			arena.Reset();
+			Assert::AreEqual<size_t>(0, arena.BytesUsed());
+			Assert::AreEqual(reserved, arena.BytesReserved());
+			Assert::IsTrue(first == arena.Allocate(10));
+
+			arena.Release();
+			Assert::AreEqual<size_t>(0, arena.BytesUsed());
+			Assert::AreEqual<size_t>(0, arena.BytesReserved());
+		}
+
+		TEST_METHOD(Pool)
+		{
+			auto expression = [] { PoolResource pool(0); };
+			Assert::ExpectException<std::runtime_error>(expression);
+
+			PoolResource pool(24, 4);
+			Assert::AreEqual<size_t>(0, pool.BlockSize() % MemoryResource::ALIGNMENT);
+			Assert::IsTrue(pool.BlockSize() >= 24);
+
+			void* blocks[6];
+			for (void*& block : blocks)
+			{
+				block = pool.Allocate(24);
+			}
+			Assert::AreEqual<size_t>(6, pool.BlocksInUse());
+
+			pool.Deallocate(blocks[2], 24);
+			Assert::AreEqual<size_t>(5, pool.BlocksInUse());
+			Assert::IsTrue(blocks[2] == pool.Allocate(16));
+			Assert::IsTrue(blocks[3] == pool.Reallocate(blocks[3], 24, 8));
+
+			void* oversized = pool.Allocate(1000);
+			Assert::AreEqual<size_t>(6, pool.BlocksInUse());
+			pool.Deallocate(oversized, 1000);
+			pool.Deallocate(nullptr, 24);
+
+			pool.Release();
+			Assert::AreEqual<size_t>(0, pool.BlocksInUse());
+		}
+
+		TEST_METHOD(Containers)
+		{
+			ArenaResource arena;
+			{
+				Vector<int> vector(arena);
+				for (int i = 0; i < 100; ++i)
+				{
+					vector.PushBack(i);
+				}
+				Assert::IsTrue(&vector.Resource() == &arena);
+				Assert::AreEqual(99, vector.Back());
+
+				Vector<int> copy(vector);
+				Assert::IsTrue(&copy.Resource() == &MemoryResource::Heap());
+				Vector<int> moved(std::move(vector));
+				Assert::IsTrue(&moved.Resource() == &arena);
+				Assert::AreEqual<size_t>(100, moved.Size());
+
+				PoolResource pool(64);
+				SList<std::string> list(pool);
+				list.PushBack("Sector"s);
+				list.PushFront("World"s);
+				Assert::AreEqual<size_t>(2, pool.BlocksInUse());
+				SList<std::string> heapList;
+				list.MoveFrontTo(heapList);
+				Assert::AreEqual("World"s, heapList.Front());
+				Assert::AreEqual<size_t>(1, pool.BlocksInUse());
+				list.Clear();
+				Assert::AreEqual<size_t>(0, pool.BlocksInUse());
+
+				HashMap<std::string, int> hashmap(arena, 3);
+				for (int i = 0; i < 20; ++i)
+				{
+					hashmap[std::to_string(i)] = i;
+				}
+				Assert::IsTrue(&hashmap.Resource() == &arena);
+				Assert::AreEqual(13, hashmap.At("13"s));
+
+				FlatHashMap<std::string, int> flatmap(arena);
+				for (int i = 0; i < 20; ++i)
+				{
+					flatmap[std::to_string(i)] = i;
+				}
+				Assert::AreEqual(7, flatmap.At("7"s));
+
+				Datum datum(arena);
+				for (int32_t i = 0; i < 10; ++i)
+				{
+					datum.PushBack(i);
+				}
+				Assert::IsTrue(&datum.Resource() == &arena);
+				Assert::AreEqual(9, datum.Back<int32_t>());
+			}
+			Assert::IsTrue(arena.BytesUsed() > 0);
+			arena.Release();
+		}
+
+		TEST_METHOD(ScopeInArena)
+		{
+			ArenaResource arena;
+			Scope* root;
+			{
+				DefaultResourceGuard guard(arena);
+				root = new Scope();
+				for (int i = 0; i < 10; ++i)
+				{
+					Scope& child = root->AppendScope("Child"s + std::to_string(i));
+					child["Health"] = 100;
+					child["Position"] = glm::vec4(1.0f);
+					child["Name"] = "Child"s;
+				}
+			}
+			Assert::IsTrue(arena.BytesUsed() > 0);
+			Assert::IsTrue(&root->At("Child3"s).Resource() == &arena);
+
+			//Destructors still run, but nothing they hand back touches the heap; the arena frees it all at once
+			delete root;
+			arena.Release();
+			Assert::AreEqual<size_t>(0, arena.BytesReserved());
+		}
+
+		TEST_METHOD(ObjectPoolReuse)
+		{
+			ObjectPool::Statistics before = ObjectPool::GetStatistics<Scope>();
+			Assert::AreEqual<size_t>(0, before.InUse);
+			{
+				Scope root;
+				Scope& first = root.AppendScope("First"s);
+				Scope& second = root.AppendScope("Second"s);
+				Scope* clone = second.Clone();
+
+				ObjectPool::Statistics during = ObjectPool::GetStatistics<Scope>();
+				Assert::AreEqual<size_t>(3, during.InUse);
+				Assert::AreEqual(before.Allocations + 3, during.Allocations);
+
+				//A freed block is handed to the next object of the same size class
+				void* freed = &first;
+				delete &first;
+				Scope& third = root.AppendScope("Third"s);
+				Assert::IsTrue(freed == &third);
+				Assert::AreEqual<size_t>(3, ObjectPool::GetStatistics<Scope>().InUse);
+				delete clone;
+			}
+
+			ObjectPool::Statistics after = ObjectPool::GetStatistics<Scope>();
+			Assert::AreEqual<size_t>(0, after.InUse);
+			Assert::AreEqual(before.Allocations + 4, after.Allocations);
+			Assert::AreEqual(after.Allocations, after.Deallocations);
+			Assert::AreEqual(before.ChunkAllocations + 1, after.ChunkAllocations);
+
+			//The emptied size class keeps its chunk, so a temporary object never goes back to the heap until Trim
+			Assert::AreEqual(static_cast<size_t>(ObjectPool::BLOCKS_PER_CHUNK), after.BlocksReserved);
+			Scope prototype;
+			for (int i = 0; i < 100; ++i)
+			{
+				delete prototype.Clone();
+			}
+			Assert::AreEqual(after.ChunkAllocations, ObjectPool::GetStatistics<Scope>().ChunkAllocations);
+			ObjectPool::Trim();
+			Assert::AreEqual<size_t>(0, ObjectPool::GetStatistics<Scope>().BlocksReserved);
+
+			Assert::AreEqual<size_t>(0, ObjectPool::GetStatistics(ObjectPool::MAX_POOLED_SIZE + 1).Allocations);
+			Assert::IsTrue(ObjectPool::GetTotalStatistics().Allocations >= after.Allocations);
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+	_CrtMemState MemoryResourceTests::sStartMemState;
+}
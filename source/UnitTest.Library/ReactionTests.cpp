@@ -66,6 +66,7 @@ namespace UnitTests
 
 		TEST_METHOD_CLEANUP(Cleanup)
 		{
+			ObjectPool::Trim();
 #if defined(DEBUG) || defined(_DEBUG)
 			_CrtMemState end_mem_state, diff_mem_state;
 			_CrtMemCheckpoint(&end_mem_state);
@@ -300,6 +301,47 @@ namespace UnitTests
 			Assert::AreEqual(22, (*actionIncrement2)["Number"].Get<int32_t>(0));
 		}
 
+		TEST_METHOD(PrescribedSlotIndices)
+		{
+			const std::tuple<RTTI::IdType, std::string, size_t> slots[] =
+			{
+				{ Entity::TypeIdClass(), "Name"s, Entity::NameIndex },
+				{ Entity::TypeIdClass(), "Actions"s, Entity::ActionsIndex },
+				{ Sector::TypeIdClass(), "Entities"s, Sector::EntitiesIndex },
+				{ World::TypeIdClass(), "Sectors"s, World::SectorsIndex },
+				{ Action::TypeIdClass(), Action::ActionName, Action::NameIndex },
+				{ ActionList::TypeIdClass(), ActionList::ActionsKey, ActionList::ActionsIndex },
+				{ ActionListIf::TypeIdClass(), "Condition"s, ActionListIf::ConditionIndex },
+				{ ActionListIf::TypeIdClass(), "Then"s, ActionListIf::ThenIndex },
+				{ ActionListIf::TypeIdClass(), "Else"s, ActionListIf::ElseIndex },
+				{ ActionCreateAction::TypeIdClass(), ActionCreateAction::PrototypeNameKey, ActionCreateAction::PrototypeNameIndex },
+				{ ActionCreateAction::TypeIdClass(), ActionCreateAction::ActionNameKey, ActionCreateAction::ActionNameIndex },
+				{ ActionDestroyAction::TypeIdClass(), ActionDestroyAction::ActionInstanceKey, ActionDestroyAction::ActionInstanceIndex },
+				{ ActionEvent::TypeIdClass(), ActionEvent::SubtypeKey, ActionEvent::SubtypeIndex },
+				{ ActionEvent::TypeIdClass(), ActionEvent::DelayKey, ActionEvent::DelayIndex },
+				{ Reaction::TypeIdClass(), ActionList::ActionsKey, Reaction::ActionsIndex },
+				{ ReactionAttributed::TypeIdClass(), ReactionAttributed::SubtypeKey, ReactionAttributed::SubtypeIndex },
+				{ EventMessageAttributed::TypeIdClass(), EventMessageAttributed::SubtypeKey, EventMessageAttributed::SubtypeIndex }
+			};
+			for (const auto& [typeID, name, index] : slots)
+			{
+				Assert::AreEqual(index, TypeRegistry::PrescribedAttributeIndex(typeID, name));
+			}
+			Assert::ExpectException<std::runtime_error>([] { TypeRegistry::PrescribedAttributeIndex(Entity::TypeIdClass(), "Missing"s); });
+
+			Assert::AreEqual(Entity::PrescribedSlotCount, TypeRegistry::PrescribedAttributeCount(Entity::TypeIdClass()));
+			Assert::AreEqual(ActionListIf::PrescribedSlotCount, TypeRegistry::PrescribedAttributeCount(ActionListIf::TypeIdClass()));
+			Assert::AreEqual(ActionEvent::PrescribedSlotCount, TypeRegistry::PrescribedAttributeCount(ActionEvent::TypeIdClass()));
+			Assert::AreEqual(ReactionAttributed::PrescribedSlotCount, TypeRegistry::PrescribedAttributeCount(ReactionAttributed::TypeIdClass()));
+
+			ActionListIf actionListIf;
+			Assert::IsTrue(&actionListIf["Then"] == &actionListIf.PrescribedAttribute(ActionListIf::ThenIndex));
+			Assert::IsTrue(&actionListIf["Else"] == &actionListIf.PrescribedAttribute(ActionListIf::ElseIndex));
+			ReactionAttributed reactionAttributed;
+			Assert::IsTrue(&reactionAttributed.Actions() == &reactionAttributed["Actions"]);
+			Assert::IsTrue(&reactionAttributed["Subtype"] == &reactionAttributed.PrescribedAttribute(ReactionAttributed::SubtypeIndex));
+		}
+
 
 	private:
 		static _CrtMemState s_start_mem_state;
@@ -318,6 +318,36 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(c, list.Back());
 		}
 
+		TEST_METHOD(MoveFrontTo)
+		{
+			const Foo a(10);
+			const Foo b(20);
+			const Foo c(30);
+
+			SList<Foo> list;
+			SList<Foo> destination;
+			auto expression = [&] { list.MoveFrontTo(destination); };
+			Assert::ExpectException<std::runtime_error>(expression);
+
+			list.PushBack(a);
+			list.PushBack(b);
+			destination.PushBack(c);
+			const Foo* address = &list.Front();
+
+			SList<Foo>::Iterator iter = list.MoveFrontTo(destination);
+			Assert::IsTrue(address == &*iter);
+			Assert::AreEqual<size_t>(1, list.Size());
+			Assert::AreEqual(b, list.Front());
+			Assert::AreEqual(b, list.Back());
+			Assert::AreEqual<size_t>(2, destination.Size());
+			Assert::AreEqual(c, destination.Front());
+			Assert::AreEqual(a, destination.Back());
+
+			list.MoveFrontTo(destination);
+			Assert::IsTrue(list.IsEmpty());
+			Assert::AreEqual(b, destination.Back());
+		}
+
 		TEST_METHOD(IteratorBegin)
 		{
 			const Foo a(10);
@@ -1,6 +1,9 @@
 #include "pch.h"
+#include "DatumRef.h"
 #include "CppUnitTest.h"
 #include <string>
+#include <future>
+#include <vector>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace Library;
@@ -56,6 +59,7 @@ namespace UnitTestLibraryDesktop
 
 		TEST_METHOD_CLEANUP(Cleanup)
 		{
+			ObjectPool::Trim();
 			#if defined(DEBUG) || defined(_DEBUG)
 			_CrtMemState end_mem_state, diff_mem_state;
 			_CrtMemCheckpoint(&end_mem_state);
@@ -149,6 +153,33 @@ namespace UnitTestLibraryDesktop
 			Assert::IsNull(another_another_pokemon->Find("moves"));
 		}
 
+		TEST_METHOD(StringViewLookup)
+		{
+			Scope pokemon;
+			std::string_view names = "badges moves";
+			std::string_view badgesName = names.substr(0, 6);
+			std::string_view movesName = names.substr(7);
+
+			Datum& badges = pokemon.Append(badgesName);
+			Assert::IsTrue(&badges == &pokemon.Append("badges"s));
+			Assert::IsTrue(&badges == pokemon.Find(badgesName));
+			Assert::IsTrue(&badges == &pokemon.At(badgesName));
+			Assert::IsTrue(&badges == &pokemon[badgesName]);
+			Assert::IsNull(pokemon.Find(movesName));
+			Assert::AreEqual<size_t>(1, pokemon.Size());
+
+			const char* moves = "moves";
+			Scope& child = pokemon.AppendScope(moves);
+			Assert::IsTrue(&child == &pokemon.At(movesName)[0]);
+			Assert::IsTrue(pokemon.Search(movesName) == pokemon.Find("moves"s));
+
+			const Scope& constPokemon = pokemon;
+			Assert::IsTrue(&badges == constPokemon.Find(badgesName));
+			Assert::IsTrue(&badges == &constPokemon[badgesName]);
+			auto expression = [&] { constPokemon.At(names); };
+			Assert::ExpectException<std::runtime_error>(expression);
+		}
+
 		TEST_METHOD(ToString)
 		{
 			Scope sc;
@@ -298,6 +329,358 @@ namespace UnitTestLibraryDesktop
 			Assert::ExpectException<std::runtime_error>(expression2);
 		}
 
+		TEST_METHOD(ReparentKeepsSlots)
+		{
+			Scope source;
+			Scope destination;
+			Vector<Scope*> children;
+			for (size_t i = 0; i < 6; ++i)
+			{
+				children.PushBack(&source.AppendScope("Children"));
+			}
+
+			//Orphaning from the middle leaves a tombstone, reading the table removes it keeping the order, and renumbers the slots
+			destination.Adopt(*children[1], "Moved");
+			Datum& remaining = source["Children"];
+			Assert::AreEqual<size_t>(5, remaining.Size());
+			Assert::IsTrue(&destination == children[1]->GetParent());
+			for (size_t i = 0; i < remaining.Size(); ++i)
+			{
+				Assert::AreSame(*children[i == 0 ? 0 : i + 1], remaining[i]);
+				auto [datum, index] = source.FindContainedScope(remaining[i]);
+				Assert::IsTrue(datum == &remaining);
+				Assert::AreEqual(i, index);
+			}
+
+			destination.Adopt(*children[5], "Moved");
+			destination.Adopt(*children[4], "Moved");
+			Assert::AreEqual<size_t>(3, remaining.Size());
+			Assert::AreEqual<size_t>(3, destination["Moved"].Size());
+
+			//A moved-from child hands its slot to the new object
+			Scope* moved = new Scope(std::move(*children[0]));
+			delete children[0];
+			Assert::AreSame(*moved, remaining[0]);
+			Assert::IsTrue(&source == moved->GetParent());
+			Assert::AreEqual<size_t>(0, source.FindContainedScope(*moved).second);
+
+			delete children[2];
+			Assert::AreEqual<size_t>(2, remaining.Size());
+			Assert::AreSame(*children[3], remaining[1]);
+
+			//A stale slot from editing the table directly falls back to a scan
+			remaining.Set(*moved, 1);
+			remaining.Set(*children[3], 0);
+			Assert::AreEqual<size_t>(1, source.FindContainedScope(*moved).second);
+			delete moved;
+			Assert::AreEqual<size_t>(1, remaining.Size());
+			Assert::AreSame(*children[3], remaining[0]);
+		}
+
+		TEST_METHOD(ReparentTouchesNoSiblings)
+		{
+			Scope source;
+			Scope destination;
+			const size_t childCount = 5000;
+			const size_t movedCount = 2000;
+			Vector<Scope*> children(childCount);
+			for (size_t i = 0; i < childCount; ++i)
+			{
+				children.PushBack(&source.AppendScope("Children"));
+			}
+
+			//Every move from the front only leaves a tombstone, no sibling is shifted until the table is read
+			const Datum& table = *source.Find("Children");
+			for (size_t i = 0; i < movedCount; ++i)
+			{
+				destination.Adopt(*children[i], "Moved");
+			}
+			Assert::AreEqual<size_t>(movedCount, table.TombstoneCount());
+
+			//The first read removes them all in one pass, keeping the order and renumbering the slots
+			Assert::AreEqual<size_t>(childCount - movedCount, table.Size());
+			Assert::AreEqual<size_t>(0, table.TombstoneCount());
+			for (size_t i = 0; i < table.Size(); ++i)
+			{
+				Assert::AreSame(*children[movedCount + i], table[i]);
+				Assert::AreEqual(i, source.FindContainedScope(table[i]).second);
+			}
+			const Datum& moved = destination["Moved"];
+			for (size_t i = 0; i < moved.Size(); ++i)
+			{
+				Assert::AreSame(*children[i], moved[i]);
+			}
+
+			//Orphaning from the back pops the slot along with the tombstones before it
+			delete children[childCount - 2];
+			Assert::AreEqual<size_t>(1, table.TombstoneCount());
+			delete children[childCount - 1];
+			Assert::AreEqual<size_t>(0, table.TombstoneCount());
+			Assert::AreEqual<size_t>(childCount - movedCount - 2, table.Size());
+
+			//Moving a whole table leaves the source empty without compacting it
+			destination.MoveChildren(source, "Children", "Moved");
+			Assert::AreEqual<size_t>(0, table.TombstoneCount());
+			Assert::AreEqual<size_t>(0, table.Size());
+			Assert::AreEqual<size_t>(childCount - 2, moved.Size());
+			Assert::AreSame(*children[childCount - 3], moved[childCount - 3]);
+		}
+
+		TEST_METHOD(CloneShared)
+		{
+			Scope prototype;
+			Datum& names = prototype["Names"];
+			names = "Alpha"s;
+			names.PushBack("Beta"s);
+			names.PushBack("Gamma"s);
+			Scope& nested = prototype.AppendScope("Nested");
+			Datum& transforms = nested["Transforms"];
+			transforms = glm::mat4(1.0f);
+			transforms.PushBack(glm::mat4(2.0f));
+
+			Scope* clone = prototype.CloneShared();
+			Assert::IsTrue(*clone == prototype);
+			Assert::IsTrue(names.IsShared());
+			Assert::IsTrue(transforms.IsShared());
+			Scope& clonedNested = (*clone)["Nested"][0];
+			Assert::AreNotSame(nested, clonedNested);
+			Assert::IsTrue(clone == clonedNested.GetParent());
+
+			clonedNested["Transforms"].Set(glm::mat4(3.0f), 1);
+			Assert::IsFalse(transforms.IsShared());
+			Assert::IsTrue(glm::mat4(2.0f) == transforms.Get<glm::mat4>(1));
+			Assert::IsTrue(*clone != prototype);
+
+			delete clone;
+			Assert::IsFalse(names.IsShared());
+			Assert::AreEqual("Beta"s, names.Get<std::string>(1));
+		}
+
+		TEST_METHOD(CloneSharedWithHeldReference)
+		{
+			Scope prototype;
+			Datum& names = prototype["Names"];
+			names = "Alpha"s;
+			names.PushBack("Beta"s);
+			std::string& held = names.Get<std::string>(0);
+
+			//A write through the reference must not reach the clone, so the buffer is copied rather than shared
+			Scope* clone = prototype.CloneShared();
+			Assert::IsFalse(names.IsShared());
+			held = "Changed"s;
+			Assert::AreEqual("Alpha"s, (*clone)["Names"].Get<std::string>(0));
+			Assert::AreEqual("Changed"s, names.Get<std::string>(0));
+			delete clone;
+
+			//A prototype nobody holds references into is shared, also by clones made on several threads at once
+			Scope untouched;
+			Datum& scores = untouched["Scores"];
+			for (int32_t i = 0; i < 100; ++i)
+			{
+				scores.PushBack(i);
+			}
+			const Scope& constUntouched = untouched;
+			std::vector<std::future<gsl::owner<Scope*>>> spawns;
+			for (size_t i = 0; i < 8; ++i)
+			{
+				spawns.push_back(std::async(std::launch::async, [&constUntouched]
+				{
+					return constUntouched.CloneShared();
+				}));
+			}
+			std::vector<gsl::owner<Scope*>> clones;
+			for (auto& spawn : spawns)
+			{
+				clones.push_back(spawn.get());
+			}
+			Assert::IsTrue(scores.IsShared());
+			for (gsl::owner<Scope*> sharedClone : clones)
+			{
+				Assert::IsTrue(*sharedClone == untouched);
+				delete sharedClone;
+			}
+			Assert::IsFalse(scores.IsShared());
+			Assert::AreEqual(99, scores.Get<int32_t>(99));
+		}
+
+		TEST_METHOD(FootprintAndCompact)
+		{
+			Scope level(64);
+			Datum& integers = level["Integers"];
+			integers.SetType(Datum::DatumType::INTEGER);
+			for (int32_t i = 0; i < 100; ++i)
+			{
+				integers.PushBack(i);
+			}
+			level["Name"] = std::string(64, 'x');
+			for (int32_t i = 0; i < 3; ++i)
+			{
+				level.AppendScope("Children")["Health"] = i;
+			}
+
+			MemoryFootprint before = level.Footprint();
+			Assert::AreEqual(size_t(4), before.Scopes);
+			Assert::IsTrue(before.DatumSlack > 0);
+			Assert::IsTrue(before.HashMapSlotSlack > 0);
+			Assert::IsTrue(before.Strings > 64);
+
+			level.Compact();
+			MemoryFootprint after = level.Footprint();
+			Assert::AreEqual(size_t(4), after.Scopes);
+			Assert::AreEqual(size_t(0), after.DatumSlack);
+			Assert::AreEqual(size_t(0), after.VectorSlack);
+			Assert::IsTrue(after.HashMapSlotSlack < before.HashMapSlotSlack);
+			Assert::AreEqual(before.Used(), after.Used());
+			Assert::IsTrue(after.Total() < before.Total());
+
+			//Compacting keeps every reference valid
+			Assert::IsTrue(&integers == level.Find("Integers"));
+			Assert::AreEqual(99, integers.Get<int32_t>(99));
+			Assert::AreEqual(2, level["Children"][2]["Health"].Get<int32_t>(0));
+			Assert::IsTrue(&level == level["Children"][1].GetParent());
+			level.AppendScope("Children");
+			Assert::AreEqual<size_t>(4, level["Children"].Size());
+		}
+
+		TEST_METHOD(StructuralHash)
+		{
+			Scope first;
+			first["Health"] = 100;
+			first["Names"] = "Alpha"s;
+			first.AppendScope("Nested")["Speed"] = 1.5f;
+			Scope second(first);
+			Assert::AreEqual(first.StructuralHash(), second.StructuralHash());
+			Assert::IsTrue(first == second);
+
+			//A write deep in the tree marks every ancestor stale
+			second["Nested"][0]["Speed"].Set(2.5f);
+			Assert::AreNotEqual(first.StructuralHash(), second.StructuralHash());
+			Assert::IsTrue(first != second);
+			second["Nested"][0]["Speed"].Set(1.5f);
+			Assert::AreEqual(first.StructuralHash(), second.StructuralHash());
+			Assert::IsTrue(first == second);
+
+			//Order matters, as it does to operator==
+			Scope reordered;
+			reordered["Names"] = "Alpha"s;
+			reordered["Health"] = 100;
+			reordered.AppendScope("Nested")["Speed"] = 1.5f;
+			Assert::AreNotEqual(first.StructuralHash(), reordered.StructuralHash());
+			Assert::IsTrue(first != reordered);
+
+			//Structural changes count as writes
+			const size_t hash = first.StructuralHash();
+			Scope& moved = first["Nested"][0];
+			second.Adopt(moved, "Extra");
+			Assert::AreNotEqual(hash, first.StructuralHash());
+			first.Adopt(moved, "Nested");
+			Assert::AreEqual(hash, first.StructuralHash());
+			first.AppendScope("Nested");
+			Assert::AreNotEqual(hash, first.StructuralHash());
+
+			//External storage is rehashed on every call and hashes like the same values stored internally
+			int32_t external = 5;
+			Scope externalScope;
+			externalScope["Value"].SetStorage(&external, 1);
+			externalScope.AppendScope("Child")["Value"] = 1;
+			Scope internalScope;
+			internalScope["Value"] = 5;
+			internalScope.AppendScope("Child")["Value"] = 1;
+			Assert::AreEqual(internalScope.StructuralHash(), externalScope.StructuralHash());
+			Assert::IsTrue(internalScope == externalScope);
+			external = 6;
+			Assert::AreNotEqual(internalScope.StructuralHash(), externalScope.StructuralHash());
+			Assert::IsTrue(internalScope != externalScope);
+		}
+
+		TEST_METHOD(StructuralHashAfterMutableViews)
+		{
+			//Writes through a reference or span handed out before the comparison are seen by later comparisons
+			Scope first;
+			first["Value"] = 1;
+			first["Values"].PushBack(1.0f);
+			first.AppendScope("Nested")["Names"] = "Alpha"s;
+			Scope second(first);
+
+			int32_t& value = first["Value"].Get<int32_t>();
+			Span<float_t> values = first["Values"].AsSpan<float_t>();
+			DatumRef<std::string> names(first["Nested"][0]["Names"]);
+			std::string& name = names[0];
+			Assert::IsTrue(first == second);
+			Assert::AreEqual(first.StructuralHash(), second.StructuralHash());
+
+			value = 7;
+			second["Value"].Set(7);
+			Assert::IsTrue(first == second);
+			Assert::AreEqual(first.StructuralHash(), second.StructuralHash());
+
+			values[0] = 2.0f;
+			Assert::IsTrue(first != second);
+			Assert::AreNotEqual(first.StructuralHash(), second.StructuralHash());
+			second["Values"].Set(2.0f);
+			Assert::IsTrue(first == second);
+
+			name = "Beta";
+			Assert::IsTrue(first != second);
+			second["Nested"][0]["Names"].Set("Beta"s);
+			Assert::IsTrue(first == second);
+			Assert::AreEqual(first.StructuralHash(), second.StructuralHash());
+		}
+
+		TEST_METHOD(AdoptRange)
+		{
+			Scope first;
+			Scope second;
+			Vector<Scope*> children;
+			for (size_t i = 0; i < 4; ++i)
+			{
+				children.PushBack(&first.AppendScope("Children"));
+				children.PushBack(&second.AppendScope("Children"));
+			}
+			Scope* orphan = new Scope();
+
+			//Takes from both sources, keeps the order of the range and of the siblings left behind
+			Scope destination;
+			Vector<Scope*> batch{ children[6], children[1], children[2], orphan, children[2] };
+			destination.AdoptRange(batch.AsSpan(), "Moved");
+			Datum& moved = destination["Moved"];
+			Assert::AreEqual<size_t>(4, moved.Size());
+			Assert::AreSame(*children[6], moved[0]);
+			Assert::AreSame(*children[1], moved[1]);
+			Assert::AreSame(*children[2], moved[2]);
+			Assert::AreSame(*orphan, moved[3]);
+			for (size_t i = 0; i < moved.Size(); ++i)
+			{
+				Assert::IsTrue(&destination == moved[i].GetParent());
+				Assert::AreEqual(i, destination.FindContainedScope(moved[i]).second);
+			}
+
+			Datum& firstChildren = first["Children"];
+			Assert::AreEqual<size_t>(2, firstChildren.Size());
+			Assert::AreSame(*children[0], firstChildren[0]);
+			Assert::AreSame(*children[4], firstChildren[1]);
+			Assert::AreEqual<size_t>(1, first.FindContainedScope(*children[4]).second);
+			Datum& secondChildren = second["Children"];
+			Assert::AreEqual<size_t>(3, secondChildren.Size());
+			Assert::AreSame(*children[7], secondChildren[2]);
+
+			//Moves a whole table
+			destination.MoveChildren(second, "Children", "Moved");
+			Assert::AreEqual<size_t>(0, secondChildren.Size());
+			Assert::AreEqual<size_t>(7, moved.Size());
+			Assert::AreSame(*children[3], moved[4]);
+			Assert::AreSame(*children[7], moved[6]);
+			Assert::IsTrue(&destination == children[7]->GetParent());
+
+			//Ancestry is validated before anything moves
+			Scope& grandchild = children[0]->AppendScope("Nested");
+			Vector<Scope*> invalid{ children[4], children[0] };
+			Assert::ExpectException<std::runtime_error>([&] { grandchild.AdoptRange(invalid.AsSpan(), "Ancestors"); });
+			Assert::IsTrue(&first == children[4]->GetParent());
+			Assert::AreEqual<size_t>(2, firstChildren.Size());
+			Assert::ExpectException<std::runtime_error>([&] { destination.MoveChildren(first, "Missing", "Moved"); });
+		}
+
 		TEST_METHOD(Append)
 		{
 			//Testing edge casses
@@ -4,6 +4,7 @@
 #include "Foo.h"
 #include <gsl/gsl>
 #include <glm/glm.hpp>
+#include <memory>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace Library;
@@ -436,6 +437,51 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual<size_t>(20, list.Capacity());
 		}
 
+		TEST_METHOD(GrowthStrategies)
+		{
+			const Foo a(10);
+
+			Vector<Foo> list;
+			Assert::IsTrue(list.GetGrowthStrategy() == &IncrementStrategy::Grow);
+			auto expression = [&list] { list.SetGrowthStrategy(nullptr); };
+			Assert::ExpectException<std::exception>(expression);
+
+			list.SetGrowthStrategy(&GoldenRatioStrategy::Grow);
+			list.PushBack(a);
+			Assert::AreEqual<size_t>(4, list.Capacity());
+			list.Resize(4);
+			list.PushBack(a);
+			Assert::AreEqual<size_t>(7, list.Capacity());
+
+			Vector<Foo> copy(list);
+			Assert::IsTrue(copy.GetGrowthStrategy() == &GoldenRatioStrategy::Grow);
+
+			list.SetGrowthStrategy(&FixedChunkStrategy<16>::Grow);
+			list.Resize(7);
+			list.PushBack(a);
+			Assert::AreEqual<size_t>(23, list.Capacity());
+
+			list.SetGrowthStrategy(&ExactFitStrategy::Grow);
+			list.ShrinkToFit();
+			list.PushBack(a);
+			Assert::AreEqual<size_t>(9, list.Capacity());
+
+			list.SetGrowthStrategy([](size_t, size_t capacity) { return capacity; });
+			auto growth = [&list, &a] { list.ShrinkToFit(); list.PushBack(a); };
+			Assert::ExpectException<std::exception>(growth);
+
+			{
+				GrowthStrategyGuard guard(&ExactFitStrategy::Grow);
+				Vector<Foo> guarded;
+				guarded.PushBack(a);
+				Assert::AreEqual<size_t>(1, guarded.Capacity());
+				Datum datum;
+				Assert::IsTrue(datum.GetGrowthStrategy() == &ExactFitStrategy::Grow);
+			}
+			Vector<Foo> unguarded;
+			Assert::IsTrue(unguarded.GetGrowthStrategy() == &IncrementStrategy::Grow);
+		}
+
 		TEST_METHOD(Find)
 		{
 			const Foo a(10);
@@ -554,6 +600,91 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(Foo(0), list.Back());
 		}
 
+		TEST_METHOD(NonTriviallyRelocatable)
+		{
+			static_assert(IsTriviallyRelocatable<int>::value);
+			static_assert(IsTriviallyRelocatable<glm::vec4>::value);
+			static_assert(!IsTriviallyRelocatable<std::string>::value);
+
+			//Short strings live inside the string object, so a bytewise move would leave them pointing at the old block
+			Vector<std::string> strings;
+			for (int i = 0; i < 100; ++i)
+			{
+				strings.PushBack(std::to_string(i));
+			}
+			strings.ShrinkToFit();
+			strings.Remove(strings.begin());
+			strings.Resize(200);
+			Assert::AreEqual<size_t>(200, strings.Size());
+			Assert::AreEqual(std::string("1"), strings.Front());
+			Assert::AreEqual(std::string("99"), strings[98]);
+			Assert::AreEqual(std::string(), strings.Back());
+
+			//Arguments referring into the vector stay valid while it grows
+			Vector<std::string> aliased;
+			aliased.PushBack(std::string("Sector"));
+			aliased.ShrinkToFit();
+			aliased.PushBack(aliased.Front());
+			aliased.EmplaceBack(aliased[1], 0, 3);
+			Assert::AreEqual(std::string("Sector"), aliased[1]);
+			Assert::AreEqual(std::string("Sec"), aliased[2]);
+		}
+
+		TEST_METHOD(AsSpan)
+		{
+			Vector<int> numbers;
+			Assert::IsTrue(numbers.AsSpan().IsEmpty());
+			for (int i = 0; i < 10; ++i)
+			{
+				numbers.PushBack(i);
+			}
+
+			Span<int> span = numbers.AsSpan();
+			Assert::IsTrue(span.begin() == numbers.Data());
+			Assert::AreEqual<size_t>(10, span.Size());
+			span[3] = 30;
+			Assert::AreEqual(30, numbers[3]);
+			auto outOfBounds = [&span] { span[10]; };
+			Assert::ExpectException<std::exception>(outOfBounds);
+
+			const Vector<int>& constNumbers = numbers;
+			Span<const int> tail = constNumbers.AsSpan().Subspan(7);
+			Assert::AreEqual<size_t>(3, tail.Size());
+			Assert::AreEqual(7, tail.Front());
+			Assert::AreEqual(9, tail.Back());
+			Assert::AreEqual<size_t>(2, constNumbers.AsSpan().Subspan(1, 2).Size());
+			Assert::IsTrue(constNumbers.AsSpan().Subspan(10).IsEmpty());
+			auto badOffset = [&constNumbers] { constNumbers.AsSpan().Subspan(11); };
+			Assert::ExpectException<std::exception>(badOffset);
+
+			int sum = 0;
+			for (int value : tail)
+			{
+				sum += value;
+			}
+			Assert::AreEqual(24, sum);
+
+			Span<int> empty;
+			auto front = [&empty] { empty.Front(); };
+			Assert::ExpectException<std::exception>(front);
+		}
+
+		TEST_METHOD(EmplaceBackMoveOnly)
+		{
+			Vector<std::unique_ptr<Foo>> foos;
+			for (int i = 0; i < 20; ++i)
+			{
+				foos.EmplaceBack(std::make_unique<Foo>(i));
+			}
+			foos.PushBack(std::make_unique<Foo>(20));
+			foos.Remove(foos.begin());
+			foos.ShrinkToFit();
+
+			Assert::AreEqual<size_t>(20, foos.Size());
+			Assert::AreEqual(Foo(1), *foos.Front());
+			Assert::AreEqual(Foo(20), *foos.Back());
+		}
+
 	private:
 		static _CrtMemState sStartMemState;
 	};
@@ -16,6 +16,7 @@
 #include "Vector.h"
 #include "HashFunctions.h"
 #include "HashMap.h"
+#include "FlatHashMap.h"
 #include "Datum.h"
 #include "Scope.h"
 #include "Attributed.h"